@@ -0,0 +1,205 @@
+// Copyright 2026 Beisent
+// AllocationTracker implementation and global operator new replacements
+
+#include "AllocationTracker.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+#include <imgui.h>
+
+namespace flux
+{
+
+    namespace
+    {
+        std::atomic<uint64_t> s_allocations{0};
+        std::atomic<uint64_t> s_bytes{0};
+        std::atomic<bool> s_imgui_hooks_installed{false};
+
+        ImGuiMemAllocFunc s_imgui_alloc = nullptr;
+        ImGuiMemFreeFunc s_imgui_free = nullptr;
+        void *s_imgui_user_data = nullptr;
+
+        void *ImGuiAlloc(size_t size, void *)
+        {
+            AllocationTracker::Count(size);
+            return s_imgui_alloc(size, s_imgui_user_data);
+        }
+
+        void ImGuiFree(void *memory, void *) { s_imgui_free(memory, s_imgui_user_data); }
+    } // namespace
+
+    bool AllocationTracker::IsEnabled()
+    {
+#if defined(FLUX_TRACK_ALLOCATIONS)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    AllocationCounts AllocationTracker::GetTotals()
+    {
+        return AllocationCounts{s_allocations.load(std::memory_order_relaxed),
+                                s_bytes.load(std::memory_order_relaxed)};
+    }
+
+    void AllocationTracker::Count(uint64_t bytes)
+    {
+        s_allocations.fetch_add(1, std::memory_order_relaxed);
+        s_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void AllocationTracker::InstallImGuiHooks()
+    {
+        if (!IsEnabled() || s_imgui_hooks_installed.exchange(true))
+        {
+            return;
+        }
+
+        ImGui::GetAllocatorFunctions(&s_imgui_alloc, &s_imgui_free, &s_imgui_user_data);
+        ImGui::SetAllocatorFunctions(ImGuiAlloc, ImGuiFree, nullptr);
+    }
+
+} // namespace flux
+
+#if defined(FLUX_TRACK_ALLOCATIONS)
+
+namespace
+{
+    void *AllocateOrNull(std::size_t size)
+    {
+        return std::malloc(size ? size : 1);
+    }
+
+    void *AllocateAligned(std::size_t size, std::size_t alignment)
+    {
+#if defined(_WIN32)
+        return _aligned_malloc(size ? size : 1, alignment);
+#else
+        // aligned_alloc wants a multiple of the alignment
+        const std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+        return std::aligned_alloc(alignment, rounded ? rounded : alignment);
+#endif
+    }
+
+    // As the default operator new does: a failed allocation calls the installed
+    // new_handler, which may free memory, and tries again. Only without a handler
+    // does it throw.
+    template <typename Allocate>
+    void *AllocateOrThrow(std::size_t size, Allocate allocate)
+    {
+        while (true)
+        {
+            if (void *memory = allocate())
+            {
+                flux::AllocationTracker::Count(size);
+                return memory;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+            {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+
+    void FreeAligned(void *memory)
+    {
+#if defined(_WIN32)
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+} // namespace
+
+void *operator new(std::size_t size)
+{
+    return AllocateOrThrow(size, [size]() { return AllocateOrNull(size); });
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+
+// The nothrow versions run the new_handler too, and return null where it throws
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return operator new(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    return AllocateOrThrow(size, [size, alignment]()
+                           { return AllocateAligned(size, static_cast<std::size_t>(alignment)); });
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return operator new(size, alignment);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t &tag) noexcept
+{
+    return operator new(size, alignment, tag);
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+void operator delete[](void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+
+void operator delete(void *memory, std::align_val_t) noexcept { FreeAligned(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { FreeAligned(memory); }
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept
+{
+    FreeAligned(memory);
+}
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept
+{
+    FreeAligned(memory);
+}
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept
+{
+    FreeAligned(memory);
+}
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept
+{
+    FreeAligned(memory);
+}
+
+#endif // FLUX_TRACK_ALLOCATIONS
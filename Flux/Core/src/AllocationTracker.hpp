@@ -0,0 +1,43 @@
+// Copyright 2026 Beisent
+// Heap allocation counters for Flux framework
+
+#ifndef FLUX_CORE_SRC_ALLOCATIONTRACKER_HPP_
+#define FLUX_CORE_SRC_ALLOCATIONTRACKER_HPP_
+
+#include <cstdint>
+
+namespace flux
+{
+
+    struct AllocationCounts
+    {
+        uint64_t allocations = 0;
+        uint64_t bytes = 0; // Requested sizes, frees are not subtracted
+
+        [[nodiscard]] AllocationCounts operator-(const AllocationCounts &other) const
+        {
+            return AllocationCounts{allocations - other.allocations, bytes - other.bytes};
+        }
+    };
+
+    // Process-wide counters fed by the global operator new replacements (built with
+    // the FLUX_TRACK_ALLOCATIONS CMake option) and by ImGui's allocator hook.
+    // Counting is two relaxed atomic adds per allocation.
+    class AllocationTracker
+    {
+    public:
+        [[nodiscard]] static bool IsEnabled();
+        [[nodiscard]] static AllocationCounts GetTotals();
+
+        // Routes ImGui's allocations through the counters, chaining to whatever
+        // allocator was installed before. Must run before the first ImGui context is
+        // created; later calls do nothing.
+        static void InstallImGuiHooks();
+
+        // Used by the operator new replacements
+        static void Count(uint64_t bytes);
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_ALLOCATIONTRACKER_HPP_
@@ -2,9 +2,14 @@
 // Application class implementation
 
 #include "Application.hpp"
+#include "ProfilerLayer.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
 #include <utility>
+#include <variant>
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
@@ -19,13 +24,21 @@ namespace flux
     struct Application::PlatformState
     {
         GLFWwindow *window_handle = nullptr;
+
+        // Offscreen render target used in headless mode
+        GLuint headless_framebuffer = 0;
+        GLuint headless_color = 0;
+        GLuint headless_depth = 0;
     };
 
     // Static callback wrapper
     static Application *s_application_instance = nullptr;
 
+    // Pointer motion beyond this many events waiting for the update thread is dropped
+    static constexpr size_t kMaxUpdateEventOverflow = 4096;
+
     Application::Application(const ApplicationSpecification &spec)
-        : specification_(spec)
+        : specification_(spec), frame_arena_(spec.frame_arena_bytes)
     {
         s_application_instance = this;
 
@@ -36,47 +49,92 @@ namespace flux
         Init();
     }
 
-    Application::~Application() = default;
+    Application::~Application()
+    {
+        // Nothing to wait for after a normal Run, which shuts down itself
+        WaitForAsyncLoads();
+    }
 
     void Application::Init()
     {
+        StartupTraceScope init_scope(startup_trace_, "Init");
+        FLUX_TRACE_THREAD_NAME("Main");
         platform_ = std::make_unique<PlatformState>();
+        job_system_ = std::make_unique<JobSystem>(specification_.worker_threads);
+
+        // Before the font job: the allocator functions are plain globals in ImGui
+        IMGUI_CHECKVERSION();
+        AllocationTracker::InstallImGuiHooks();
+
+#if IMGUI_VERSION_NUM < 19200
+        // Font files are read and rasterized while the window and context come up. The
+        // atlas needs no ImGui context, which is only created once the job has joined.
+        font_atlas_ = std::make_unique<ImFontAtlas>();
+        font_job_ = job_system_->Schedule(
+            [this]()
+            {
+                StartupTraceScope scope(startup_trace_, "LoadFonts");
+                LoadFonts(*font_atlas_);
+            });
+#endif
 
-        if (!glfwInit())
+        glfwSetErrorCallback(
+            [](int error, const char *description)
+            {
+                std::fprintf(stderr, "[Flux] GLFW error %d: %s\n", error, description);
+            });
+
+        bool window_created = false;
+        {
+            StartupTraceScope scope(startup_trace_, "CreatePlatformWindow");
+            window_created = CreatePlatformWindow();
+        }
+        if (!window_created)
         {
+            std::fprintf(stderr, "[Flux] Failed to create %s window\n",
+                         specification_.headless ? "headless" : "application");
             return;
         }
 
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-        glfwWindowHint(GLFW_RESIZABLE, specification_.resizable ? GLFW_TRUE : GLFW_FALSE);
-        glfwWindowHint(GLFW_DECORATED, specification_.decorated ? GLFW_TRUE : GLFW_FALSE);
-        glfwWindowHint(GLFW_MAXIMIZED, specification_.maximized ? GLFW_TRUE : GLFW_FALSE);
-
-        if (specification_.msaa_samples > 0)
         {
-            glfwWindowHint(GLFW_SAMPLES, specification_.msaa_samples);
+            StartupTraceScope scope(startup_trace_, "MakeContextCurrent");
+            glfwMakeContextCurrent(platform_->window_handle);
+            ConfigureSwapInterval();
         }
 
-        GLFWmonitor *monitor = specification_.fullscreen ? glfwGetPrimaryMonitor() : nullptr;
-
-        platform_->window_handle =
-            glfwCreateWindow(specification_.width, specification_.height,
-                             specification_.name.c_str(), monitor, nullptr);
-
-        if (!platform_->window_handle)
+        bool gl_loaded = false;
+        {
+            StartupTraceScope scope(startup_trace_, "LoadOpenGL");
+            gl_loaded = gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
+        }
+        if (!gl_loaded)
         {
+            std::fprintf(stderr, "[Flux] Failed to load OpenGL functions\n");
+            glfwDestroyWindow(platform_->window_handle);
+            platform_->window_handle = nullptr;
             glfwTerminate();
             return;
         }
 
-        glfwMakeContextCurrent(platform_->window_handle);
-        glfwSwapInterval(specification_.vsync ? 1 : 0);
+        frame_pacer_.Configure(specification_.target_fps, specification_.max_frames_in_flight);
 
-        if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress)))
+        TextureManagerConfig texture_config;
+        texture_config.upload_budget_bytes = specification_.texture_upload_budget_bytes;
+        texture_config.cache_budget_bytes = specification_.texture_cache_budget_bytes;
+        texture_config.eviction_frames = specification_.texture_eviction_frames;
+        texture_config.mipmaps = specification_.texture_mipmaps;
+        texture_config.disk_cache_directory = specification_.texture_disk_cache_directory;
         {
-            return;
+            StartupTraceScope scope(startup_trace_, "CreateRenderResources");
+            texture_manager_ = std::make_unique<TextureManager>(*job_system_);
+            texture_manager_->Init(texture_config);
+            texture_manager_->SetDecodedCallback([this]() { RequestRedraw(); });
+            renderer2d_.SetTextureManager(texture_manager_.get());
+
+            if (specification_.headless && !CreateHeadlessFramebuffer())
+            {
+                std::fprintf(stderr, "[Flux] Failed to create headless framebuffer\n");
+            }
         }
 
         if (specification_.msaa_samples > 0)
@@ -84,10 +142,22 @@ namespace flux
             glEnable(GL_MULTISAMPLE);
         }
 
+        for (EventQueue &queue : event_queues_)
+        {
+            queue.SetCoalescing(specification_.coalesce_events);
+        }
+        update_event_queue_.SetCoalescing(specification_.coalesce_events);
         SetupEventCallbacks();
 
-        IMGUI_CHECKVERSION();
+#if IMGUI_VERSION_NUM < 19200
+        {
+            StartupTraceScope scope(startup_trace_, "WaitForFonts");
+            job_system_->Wait(font_job_);
+        }
+        ImGui::CreateContext(font_atlas_.get());
+#else
         ImGui::CreateContext();
+#endif
         ImGuiIO &io = ImGui::GetIO();
         io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
 
@@ -96,40 +166,306 @@ namespace flux
             io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
         }
 
-        if (specification_.imgui_viewports_enabled)
+        // Platform windows would open real OS windows, so headless stays single-viewport
+        if (specification_.imgui_viewports_enabled && !specification_.headless)
         {
             io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+            viewport_renderer_.SetSkipUnchanged(specification_.skip_unchanged_viewports);
         }
 
         ImGui::StyleColorsDark();
 
+#if IMGUI_VERSION_NUM >= 19200
+        // Dynamic fonts only open the files here, nothing worth a worker
+        {
+            StartupTraceScope scope(startup_trace_, "LoadFonts");
+            LoadFonts(*io.Fonts);
+        }
+#endif
+
+        {
+            StartupTraceScope scope(startup_trace_, "InitImGuiBackends");
+            ImGui_ImplGlfw_InitForOpenGL(platform_->window_handle, true);
+            ImGui_ImplOpenGL3_Init("#version 430");
+        }
+
+        profiler_.SetEnabled(specification_.profiler_enabled);
+        if (specification_.profiler_enabled)
+        {
+            StartupTraceScope scope(startup_trace_, "InitGpuProfiler");
+            gpu_profiler_.Init();
+        }
+        profile_phases_.event_poll = RegisterProfileScope("EventPoll");
+        profile_phases_.event_dispatch = RegisterProfileScope("EventDispatch");
+        profile_phases_.texture_upload = RegisterProfileScope("TextureUpload");
+        profile_phases_.clear = RegisterProfileScope("Clear");
+        profile_phases_.fixed_update = RegisterProfileScope("FixedUpdate");
+        profile_phases_.update = RegisterProfileScope("Update");
+        profile_phases_.render_ui = RegisterProfileScope("RenderUI");
+        profile_phases_.imgui_render = RegisterProfileScope("ImGui::Render");
+        profile_phases_.render_draw_data = RegisterProfileScope("RenderDrawData");
+        profile_phases_.platform_windows = RegisterProfileScope("PlatformWindows");
+        profile_phases_.swap = RegisterProfileScope("SwapBuffers");
+
+        if (specification_.profiler_enabled && specification_.profiler_overlay)
+        {
+            auto overlay = std::make_unique<ProfilerLayer>(
+                profiler_, &gpu_profiler_, specification_.profiler_frame_budget_ms);
+            overlay->SetFrameAllocations(&frame_allocations_, &frame_arena_);
+            overlay->SetRenderer2DStats(&renderer2d_.GetStats());
+            overlay->SetImGuiRendererStats(&imgui_renderer_.GetStats());
+            overlay->SetViewportStats(&viewport_renderer_.GetStats());
+            overlay->SetUpdateProfiler(&update_profiler_);
+            PushOverlay(std::move(overlay));
+        }
+    }
+
+    void Application::LoadFonts(ImFontAtlas &atlas)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
         // 加载字体
         ImFontConfig font_config;
         font_config.OversampleH = 1;
         font_config.OversampleV = 1;
         font_config.PixelSnapH = true;
+        font_config.SizePixels = specification_.imgui_font_size;
+
+        ImFontConfig merge_config = font_config;
+        merge_config.SizePixels = specification_.imgui_merge_font_size;
+        merge_config.MergeMode = true;
+        merge_config.GlyphMinAdvanceX = specification_.imgui_merge_font_size;
+
+        const bool load_font = !specification_.imgui_font_path.empty();
+        const bool load_merge_font = specification_.imgui_enable_merge_font &&
+                                     !specification_.imgui_merge_font_path.empty();
+
+#if IMGUI_VERSION_NUM >= 19200
+        // 动态字体：字形在首次使用时才光栅化，无需预先烘焙完整的中文范围
+        const ImWchar *merge_ranges = nullptr;
+        font_stats_.dynamic_glyphs = true;
+#else
+        // 使用 ImGui 的完整 Unicode 范围，烘焙结果缓存到磁盘
+        const ImWchar *merge_ranges = atlas.GetGlyphRangesChineseFull();
+        FontAtlasCache atlas_cache(specification_.imgui_font_cache_path);
+        if (load_font)
+        {
+            atlas_cache.AddSource(specification_.imgui_font_path, font_config, nullptr);
+        }
+        if (load_merge_font)
+        {
+            atlas_cache.AddSource(specification_.imgui_merge_font_path, merge_config,
+                                  merge_ranges);
+        }
+        font_stats_.from_cache = (load_font || load_merge_font) && atlas_cache.Load(atlas);
+#endif
+
+        if (!font_stats_.from_cache)
+        {
+            // 添加默认字体
+            if (load_font)
+            {
+                atlas.AddFontFromFileTTF(specification_.imgui_font_path.c_str(),
+                    specification_.imgui_font_size, &font_config);
+            }
+
+            // 添加合并字体
+            if (load_merge_font)
+            {
+                atlas.AddFontFromFileTTF(specification_.imgui_merge_font_path.c_str(),
+                    specification_.imgui_merge_font_size, &merge_config, merge_ranges);
+            }
+
+#if IMGUI_VERSION_NUM < 19200
+            if (atlas_cache.IsEnabled() && (load_font || load_merge_font))
+            {
+                atlas.Build();
+                atlas_cache.Store(atlas);
+            }
+#endif
+        }
+
+#if IMGUI_VERSION_NUM < 19200
+        // Otherwise the backend builds it on the first frame, outside this measurement
+        if (!atlas.IsBuilt())
+        {
+            atlas.Build();
+        }
+        font_stats_.width = atlas.TexWidth;
+        font_stats_.height = atlas.TexHeight;
+        font_stats_.texture_bytes = static_cast<size_t>(font_stats_.width) *
+                                    font_stats_.height * 4;
+        for (const ImFont *font : atlas.Fonts)
+        {
+            font_stats_.glyph_count += font->Glyphs.Size;
+        }
+#endif
 
-        // 添加默认字体
-        if (!specification_.imgui_font_path.empty())
+        font_stats_.load_ms = std::chrono::duration<double, std::milli>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count();
+
+        if ((!load_font && !load_merge_font) || !specification_.log_startup_stats)
+        {
+            return;
+        }
+        if (font_stats_.dynamic_glyphs)
+        {
+            std::fprintf(stderr, "[Flux] Fonts ready in %.1f ms, glyphs are rasterized on demand\n",
+                         font_stats_.load_ms);
+        }
+        else
+        {
+            std::fprintf(stderr,
+                         "[Flux] Font atlas %dx%d (%.1f MB, %d glyphs) ready in %.1f ms%s\n",
+                         font_stats_.width, font_stats_.height,
+                         static_cast<double>(font_stats_.texture_bytes) / (1024.0 * 1024.0),
+                         font_stats_.glyph_count, font_stats_.load_ms,
+                         font_stats_.from_cache ? " from cache" : "");
+        }
+    }
+
+    void Application::ConfigureSwapInterval()
+    {
+        if (!specification_.vsync || specification_.headless)
         {
-            io.Fonts->AddFontFromFileTTF(specification_.imgui_font_path.c_str(),
-                specification_.imgui_font_size, &font_config);
+            glfwSwapInterval(0);
+            return;
         }
 
-        // 添加合并字体
-        if (specification_.imgui_enable_merge_font && !specification_.imgui_merge_font_path.empty())
+        // Adaptive vsync tears instead of stalling a full interval on a missed frame
+        const bool tear_supported = glfwExtensionSupported("WGL_EXT_swap_control_tear") ||
+                                    glfwExtensionSupported("GLX_EXT_swap_control_tear");
+        const bool adaptive = specification_.adaptive_vsync && tear_supported;
+        glfwSwapInterval(adaptive ? -1 : 1);
+        frame_pacer_.SetAdaptiveVsyncActive(adaptive);
+    }
+
+    void Application::PollEvents()
+    {
+        ProfileScope scope(profiler_, profile_phases_.event_poll);
+        glfwPollEvents();
+        frame_pacer_.OnInputSampled();
+    }
+
+    bool Application::CreatePlatformWindow()
+    {
+        const bool headless = specification_.headless;
+
+        // Headless first tries a hidden window on the native platform (real display or
+        // Xvfb), then GLFW's null platform with an OSMesa software context.
+        for (int attempt = 0; attempt < 2; ++attempt)
         {
-            font_config.MergeMode = true;
-            font_config.GlyphMinAdvanceX = specification_.imgui_merge_font_size;
+            if (attempt == 1)
+            {
+#if defined(GLFW_PLATFORM_NULL)
+                if (!headless)
+                {
+                    break;
+                }
+                glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#else
+                break;
+#endif
+            }
+
+            if (!glfwInit())
+            {
+                continue;
+            }
+
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+            glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+            glfwWindowHint(GLFW_RESIZABLE, specification_.resizable ? GLFW_TRUE : GLFW_FALSE);
+            glfwWindowHint(GLFW_DECORATED, specification_.decorated ? GLFW_TRUE : GLFW_FALSE);
+            glfwWindowHint(GLFW_MAXIMIZED, specification_.maximized ? GLFW_TRUE : GLFW_FALSE);
+
+            if (headless)
+            {
+                glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+                if (attempt == 1)
+                {
+                    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+                }
+            }
+
+            // Headless renders into its own framebuffer, MSAA is applied there
+            if (specification_.msaa_samples > 0 && !headless)
+            {
+                glfwWindowHint(GLFW_SAMPLES, specification_.msaa_samples);
+            }
+
+            GLFWmonitor *monitor =
+                specification_.fullscreen && !headless ? glfwGetPrimaryMonitor() : nullptr;
+
+            platform_->window_handle =
+                glfwCreateWindow(specification_.width, specification_.height,
+                                 specification_.name.c_str(), monitor, nullptr);
+
+            if (platform_->window_handle)
+            {
+                return true;
+            }
+
+            glfwTerminate();
+        }
+
+        return false;
+    }
 
-            // 使用 ImGui 的完整 Unicode 范围
-            io.Fonts->AddFontFromFileTTF(specification_.imgui_merge_font_path.c_str(),
-                specification_.imgui_merge_font_size, &font_config,
-                io.Fonts->GetGlyphRangesChineseFull());
+    bool Application::CreateHeadlessFramebuffer()
+    {
+        const GLsizei width = static_cast<GLsizei>(specification_.width);
+        const GLsizei height = static_cast<GLsizei>(specification_.height);
+        const GLsizei samples = std::max(specification_.msaa_samples, 0);
+
+        glGenFramebuffers(1, &platform_->headless_framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, platform_->headless_framebuffer);
+
+        glGenRenderbuffers(1, &platform_->headless_color);
+        glBindRenderbuffer(GL_RENDERBUFFER, platform_->headless_color);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, GL_RGBA8, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                                  platform_->headless_color);
+
+        glGenRenderbuffers(1, &platform_->headless_depth);
+        glBindRenderbuffer(GL_RENDERBUFFER, platform_->headless_depth);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, GL_DEPTH24_STENCIL8, width,
+                                         height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER,
+                                  platform_->headless_depth);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        const bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        if (!complete)
+        {
+            DestroyHeadlessFramebuffer();
         }
 
-        ImGui_ImplGlfw_InitForOpenGL(platform_->window_handle, true);
-        ImGui_ImplOpenGL3_Init("#version 430");
+        glViewport(0, 0, width, height);
+        return complete;
+    }
+
+    void Application::DestroyHeadlessFramebuffer()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        if (platform_->headless_framebuffer)
+        {
+            glDeleteFramebuffers(1, &platform_->headless_framebuffer);
+            platform_->headless_framebuffer = 0;
+        }
+        if (platform_->headless_color)
+        {
+            glDeleteRenderbuffers(1, &platform_->headless_color);
+            platform_->headless_color = 0;
+        }
+        if (platform_->headless_depth)
+        {
+            glDeleteRenderbuffers(1, &platform_->headless_depth);
+            platform_->headless_depth = 0;
+        }
     }
 
     void Application::SetupEventCallbacks()
@@ -137,15 +473,23 @@ namespace flux
         glfwSetWindowCloseCallback(platform_->window_handle,
             [](GLFWwindow *window)
             {
-                WindowCloseEvent event;
-                s_application_instance->OnEvent(event);
+                s_application_instance->QueueEvent(WindowCloseEvent());
             });
 
+        // Not forwarded to layers, only wake lazy rendering
+        glfwSetWindowRefreshCallback(platform_->window_handle,
+            [](GLFWwindow *window) { s_application_instance->RequestRedraw(); });
+
+        glfwSetWindowFocusCallback(platform_->window_handle,
+            [](GLFWwindow *window, int focused) { s_application_instance->RequestRedraw(); });
+
+        glfwSetCursorEnterCallback(platform_->window_handle,
+            [](GLFWwindow *window, int entered) { s_application_instance->RequestRedraw(); });
+
         glfwSetWindowSizeCallback(platform_->window_handle,
             [](GLFWwindow *window, int width, int height)
             {
-                WindowResizeEvent event(width, height);
-                s_application_instance->OnEvent(event);
+                s_application_instance->QueueEvent(WindowResizeEvent(width, height));
             });
 
         glfwSetKeyCallback(platform_->window_handle,
@@ -155,20 +499,17 @@ namespace flux
                 {
                 case GLFW_PRESS:
                 {
-                    KeyPressedEvent event(key, 0);
-                    s_application_instance->OnEvent(event);
+                    s_application_instance->QueueEvent(KeyPressedEvent(key, 0));
                     break;
                 }
                 case GLFW_RELEASE:
                 {
-                    KeyReleasedEvent event(key);
-                    s_application_instance->OnEvent(event);
+                    s_application_instance->QueueEvent(KeyReleasedEvent(key));
                     break;
                 }
                 case GLFW_REPEAT:
                 {
-                    KeyPressedEvent event(key, 1);
-                    s_application_instance->OnEvent(event);
+                    s_application_instance->QueueEvent(KeyPressedEvent(key, 1));
                     break;
                 }
                 }
@@ -177,8 +518,7 @@ namespace flux
         glfwSetCharCallback(platform_->window_handle,
             [](GLFWwindow *window, unsigned int keycode)
             {
-                KeyTypedEvent event(keycode);
-                s_application_instance->OnEvent(event);
+                s_application_instance->QueueEvent(KeyTypedEvent(keycode));
             });
 
         glfwSetMouseButtonCallback(platform_->window_handle,
@@ -188,14 +528,12 @@ namespace flux
                 {
                 case GLFW_PRESS:
                 {
-                    MouseButtonPressedEvent event(button);
-                    s_application_instance->OnEvent(event);
+                    s_application_instance->QueueEvent(MouseButtonPressedEvent(button));
                     break;
                 }
                 case GLFW_RELEASE:
                 {
-                    MouseButtonReleasedEvent event(button);
-                    s_application_instance->OnEvent(event);
+                    s_application_instance->QueueEvent(MouseButtonReleasedEvent(button));
                     break;
                 }
                 }
@@ -204,33 +542,178 @@ namespace flux
         glfwSetScrollCallback(platform_->window_handle,
             [](GLFWwindow *window, double xOffset, double yOffset)
             {
-                MouseScrolledEvent event(static_cast<float>(xOffset), static_cast<float>(yOffset));
-                s_application_instance->OnEvent(event);
+                s_application_instance->QueueEvent(
+                    MouseScrolledEvent(static_cast<float>(xOffset), static_cast<float>(yOffset)));
             });
 
         glfwSetCursorPosCallback(platform_->window_handle,
             [](GLFWwindow *window, double xPos, double yPos)
             {
-                MouseMovedEvent event(static_cast<float>(xPos), static_cast<float>(yPos));
-                s_application_instance->OnEvent(event);
+                s_application_instance->QueueEvent(
+                    MouseMovedEvent(static_cast<float>(xPos), static_cast<float>(yPos)));
             });
     }
 
-    void Application::OnEvent(Event &e)
+    void Application::QueueEvent(const EventVariant &event)
     {
-        EventDispatcher dispatcher(e);
-        dispatcher.Dispatch<WindowCloseEvent>(
-            [this](WindowCloseEvent &event) { return OnWindowClose(event); });
-        dispatcher.Dispatch<WindowResizeEvent>(
-            [this](WindowResizeEvent &event) { return OnWindowResize(event); });
+        redraw_frames_ = std::max(redraw_frames_, specification_.lazy_extra_frames);
 
-        // Propagate events to layers in reverse order (top to bottom)
-        for (auto it = layer_stack_.rbegin(); it != layer_stack_.rend(); ++it)
+        if (dispatching_events_)
         {
-            if (e.handled)
-                break;
-            (*it)->OnEvent(e);
+            // Posted by a handler: waits for the next batch, never dispatched re-entrantly
+            if (!event_spill_.empty() || !event_queue_->Push(event))
+            {
+                event_spill_.push_back(event);
+            }
+            return;
+        }
+
+        // A flood larger than the queue is delivered early rather than dropped. Spilled
+        // events go first, so nothing coalesces past them.
+        while (!event_spill_.empty() || !event_queue_->Push(event))
+        {
+            ProcessEvents();
+        }
+    }
+
+    void Application::ProcessEvents()
+    {
+        if (dispatching_events_)
+        {
+            return;
+        }
+        if (update_thread_running_)
+        {
+            FlushUpdateEventOverflow();
+        }
+
+        EventQueue &batch = *event_queue_;
+        EventSpan events = batch.GetEvents();
+        if (events.empty())
+        {
+            return;
+        }
+
+        // Events queued from here on go to the other queue
+        event_queue_ = &event_queues_[event_queue_ == &event_queues_[0] ? 1 : 0];
+        dispatching_events_ = true;
+
+        ProfileScope scope(profiler_, profile_phases_.event_dispatch);
+        // Resolved at compile time, other event types fall through untouched
+        for (EventVariant &queued : events)
+        {
+            DispatchEvent(queued,
+                [this](WindowCloseEvent &event) { event.handled |= OnWindowClose(event); },
+                [this](WindowResizeEvent &event) { event.handled |= OnWindowResize(event); },
+                [this](KeyPressedEvent &event)
+                {
+                    if (specification_.trace_dump_key != 0 && event.GetRepeatCount() == 0 &&
+                        event.GetKeyCode() == specification_.trace_dump_key)
+                    {
+                        DumpTrace(specification_.trace_dump_path);
+                    }
+                });
+        }
+
+        if (update_thread_running_)
+        {
+            // Layers receive events on the update thread
+            for (EventVariant &queued : events)
+            {
+                if (!GetEventBase(queued).handled)
+                {
+                    ForwardToUpdateThread(queued);
+                }
+            }
+        }
+        else
+        {
+            DispatchToLayers(events);
+        }
+
+        batch.Clear();
+        dispatching_events_ = false;
+
+        size_t moved = 0;
+        while (moved < event_spill_.size() && event_queue_->Push(event_spill_[moved]))
+        {
+            ++moved;
+        }
+        event_spill_.erase(event_spill_.begin(), event_spill_.begin() + moved);
+    }
+
+    void Application::ForwardToUpdateThread(const EventVariant &event)
+    {
+        // Behind older overflow, pushing directly would reorder
+        if (update_event_overflow_.empty() && update_events_.TryPush(event))
+        {
+            return;
+        }
+
+        if (!update_event_overflow_.empty() &&
+            EventQueue::TryCoalesce(update_event_overflow_.back(), event))
+        {
+            return;
+        }
+
+        // Keys, buttons and window events are never dropped, only pointer motion
+        if (update_event_overflow_.size() >= kMaxUpdateEventOverflow &&
+            (std::holds_alternative<MouseMovedEvent>(event) ||
+             std::holds_alternative<MouseScrolledEvent>(event)))
+        {
+            ++dropped_update_events_;
+            return;
+        }
+        update_event_overflow_.push_back(event);
+    }
+
+    void Application::FlushUpdateEventOverflow()
+    {
+        size_t pushed = 0;
+        while (pushed < update_event_overflow_.size() &&
+               update_events_.TryPush(update_event_overflow_[pushed]))
+        {
+            ++pushed;
+        }
+        update_event_overflow_.erase(update_event_overflow_.begin(),
+                                     update_event_overflow_.begin() + pushed);
+    }
+
+    void Application::DispatchToLayers(EventSpan events)
+    {
+        int categories = 0;
+        for (EventVariant &queued : events)
+        {
+            categories |= GetEventBase(queued).GetCategoryFlags();
+        }
+
+        // One batch per layer, top to bottom, handled events stop propagating.
+        // Layers not subscribed to any category in the batch are not called at all.
+        for (Layer *layer : layer_stack_.GetEventLayers())
+        {
+            if (layer->GetEventCategoryMask() & categories)
+            {
+                FLUX_TRACE_SCOPE(layer->events_trace_name_);
+                layer->OnEvents(events);
+            }
+        }
+    }
+
+    void Application::DrainUpdateEvents()
+    {
+        EventVariant queued;
+        while (update_events_.TryPop(queued))
+        {
+            if (!update_event_queue_.Push(queued))
+            {
+                DispatchToLayers(update_event_queue_.GetEvents());
+                update_event_queue_.Clear();
+                update_event_queue_.Push(queued);
+            }
         }
+
+        DispatchToLayers(update_event_queue_.GetEvents());
+        update_event_queue_.Clear();
     }
 
     bool Application::OnWindowClose(WindowCloseEvent &e)
@@ -260,30 +743,98 @@ namespace flux
         }
 
         running_ = true;
+        frame_count_ = 0;
+        const double run_start_time = GetTime();
+        last_frame_time_ = run_start_time;
+        fixed_accumulator_ = 0.0;
+        // Lazy rendering must not wait for input before the first frames
+        redraw_frames_ = std::max(redraw_frames_, specification_.lazy_extra_frames);
+
+        defer_layer_changes_ = true;
+        if (specification_.threaded_update)
+        {
+            StartUpdateThread();
+        }
+
         while (running_)
         {
-            float time = GetTime();
+            if (specification_.lazy_rendering && !specification_.headless)
+            {
+                WaitForRedraw();
+                if (!running_)
+                {
+                    break;
+                }
+            }
+
+            FLUX_TRACE_SCOPE("Frame");
+            {
+                FLUX_TRACE_SCOPE("FramePacer");
+                frame_pacer_.WaitForNextFrame();
+            }
+
+            const AllocationCounts frame_start_allocations = AllocationTracker::GetTotals();
+            frame_arena_.Reset();
+
+            profiler_.BeginFrame();
+            gpu_profiler_.BeginFrame();
+
+            // Late sampling shortens input-to-photon latency by up to a full frame
+            if (specification_.late_input_sampling)
+            {
+                PollEvents();
+            }
+
+            ApplyLayerChanges();
+            ProcessEvents();
+
+            {
+                ProfileScope scope(profiler_, profile_phases_.texture_upload);
+                GpuProfileScope gpu_scope(&gpu_profiler_, profile_phases_.texture_upload);
+                texture_manager_->Update();
+            }
+            render_target_pool_.Update(frame_count_);
+
+            double time = GetTime();
             frame_time_ = time - last_frame_time_;
-            time_step_ = std::clamp(frame_time_, 0.0f, 0.0333f);
+            time_step_ = std::clamp(frame_time_, 0.0, 0.0333);
             last_frame_time_ = time;
 
             TimeStep timestep(time_step_);
 
+            const bool update_here = !update_thread_running_;
+            if (update_here && specification_.fixed_timestep_enabled)
+            {
+                FixedUpdateLayers(frame_time_, true);
+            }
+
+            if (platform_->headless_framebuffer)
+            {
+                glBindFramebuffer(GL_FRAMEBUFFER, platform_->headless_framebuffer);
+            }
+
             if (!minimized_)
             {
-                glClearColor(specification_.clear_color[0], specification_.clear_color[1],
-                             specification_.clear_color[2], specification_.clear_color[3]);
-                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                {
+                    ProfileScope scope(profiler_, profile_phases_.clear);
+                    GpuProfileScope gpu_scope(&gpu_profiler_, profile_phases_.clear);
+                    glClearColor(specification_.clear_color[0], specification_.clear_color[1],
+                                 specification_.clear_color[2], specification_.clear_color[3]);
+                    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                }
 
-                for (auto &layer : layer_stack_)
+                if (update_here)
                 {
-                    layer->OnUpdate(timestep);
+                    UpdateLayers(timestep, true);
                 }
             }
 
-            ImGui_ImplOpenGL3_NewFrame();
-            ImGui_ImplGlfw_NewFrame();
-            ImGui::NewFrame();
+            {
+                FLUX_TRACE_SCOPE("ImGui::NewFrame");
+                ImGui_ImplOpenGL3_NewFrame();
+                ImGui_ImplGlfw_NewFrame();
+                ImGui::NewFrame();
+            }
 
             if (specification_.imgui_docking_enabled)
             {
@@ -322,10 +873,7 @@ namespace flux
                     }
                 }
 
-                for (auto &layer : layer_stack_)
-                {
-                    layer->OnRenderUI();
-                }
+                RenderLayersUI();
 
                 ImGui::End();
                 ImGui::PopStyleVar(2);
@@ -333,45 +881,521 @@ namespace flux
             else
             {
                 // No docking - just render layers directly
-                for (auto &layer : layer_stack_)
+                RenderLayersUI();
+            }
+
+            {
+                ProfileScope scope(profiler_, profile_phases_.imgui_render);
+                ImGui::Render();
+
+                // Every viewport's draw lists count towards the texture cache LRU
+                for (ImGuiViewport *viewport : ImGui::GetPlatformIO().Viewports)
                 {
-                    layer->OnRenderUI();
+                    if (viewport->DrawData)
+                    {
+                        texture_manager_->MarkUsed(*viewport->DrawData);
+                    }
                 }
             }
-
-            ImGui::Render();
-            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            const bool drawn_outside_imgui = CheckDrawnOutsideImGui();
+            {
+                ProfileScope scope(profiler_, profile_phases_.render_draw_data);
+                GpuProfileScope gpu_scope(&gpu_profiler_, profile_phases_.render_draw_data);
+                RenderDrawData(drawn_outside_imgui);
+            }
 
             ImGuiIO &io = ImGui::GetIO();
             if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
             {
+                ProfileScope scope(profiler_, profile_phases_.platform_windows);
+                GpuProfileScope gpu_scope(&gpu_profiler_, profile_phases_.platform_windows);
                 GLFWwindow *backup_current_context = glfwGetCurrentContext();
                 ImGui::UpdatePlatformWindows();
-                ImGui::RenderPlatformWindowsDefault();
+                viewport_renderer_.Render(drawn_outside_imgui);
                 glfwMakeContextCurrent(backup_current_context);
             }
 
-            glfwSwapBuffers(platform_->window_handle);
-            glfwPollEvents();
+            {
+                ProfileScope scope(profiler_, profile_phases_.swap);
+                GpuProfileScope gpu_scope(&gpu_profiler_, profile_phases_.swap);
+                glfwSwapBuffers(platform_->window_handle);
+            }
+            renderer2d_.EndFrame();
+            frame_pacer_.OnFramePresented();
+
+            if (!specification_.late_input_sampling)
+            {
+                PollEvents();
+            }
+
+            gpu_profiler_.EndFrame();
+            profiler_.EndFrame();
+            frame_allocations_ = AllocationTracker::GetTotals() - frame_start_allocations;
+
+            ++frame_count_;
+            CompleteStartup();
+            if (specification_.max_frames > 0 && frame_count_ >= specification_.max_frames)
+            {
+                running_ = false;
+            }
+            if (specification_.max_run_seconds > 0.0 &&
+                GetTime() - run_start_time >= specification_.max_run_seconds)
+            {
+                running_ = false;
+            }
         }
 
+        StopUpdateThread();
+        defer_layer_changes_ = false;
         Shutdown();
     }
 
-    void Application::Shutdown()
+    void Application::CompleteStartup()
+    {
+        if (startup_trace_.IsFinished())
+        {
+            return;
+        }
+
+        if (frame_count_ == 1)
+        {
+            first_frame_ms_ =
+                startup_trace_.GetElapsedMilliseconds(StartupTrace::Clock::now());
+            startup_trace_.Mark("FirstFrame");
+            if (specification_.log_startup_stats)
+            {
+                std::fprintf(stderr, "[Flux] First frame presented %.1f ms after startup\n",
+                             first_frame_ms_);
+            }
+        }
+
+        // Keeps recording until the layers that were loading have caught up
+        if (pending_layer_loads_ > 0)
+        {
+            return;
+        }
+
+        startup_trace_.Mark("StartupComplete");
+        startup_trace_.Finish();
+        if (!specification_.startup_trace_path.empty() &&
+            !startup_trace_.WriteChromeTrace(specification_.startup_trace_path))
+        {
+            std::fprintf(stderr, "[Flux] Failed to write startup trace %s\n",
+                         specification_.startup_trace_path.c_str());
+        }
+    }
+
+    void Application::StartUpdateThread()
+    {
+        update_thread_running_ = true;
+        update_thread_ = std::thread([this]() { UpdateThreadLoop(); });
+    }
+
+    void Application::StopUpdateThread()
+    {
+        if (!update_thread_.joinable())
+        {
+            return;
+        }
+        update_thread_running_ = false;
+        update_thread_.join();
+
+        // Events queued after the last tick still reach the layers
+        do
+        {
+            FlushUpdateEventOverflow();
+            DrainUpdateEvents();
+        } while (!update_event_overflow_.empty());
+    }
+
+    void Application::UpdateThreadLoop()
+    {
+        using Clock = std::chrono::steady_clock;
+        const Clock::duration tick_interval =
+            specification_.update_rate_hz > 0.0
+                ? std::chrono::duration_cast<Clock::duration>(
+                      std::chrono::duration<double>(1.0 / specification_.update_rate_hz))
+                : Clock::duration::zero();
+
+        Clock::time_point next_tick = Clock::now();
+        double last_time = GetTime();
+        FLUX_TRACE_THREAD_NAME("Update");
+
+        while (update_thread_running_)
+        {
+            {
+                FLUX_TRACE_SCOPE("UpdateTick");
+                std::lock_guard<std::recursive_mutex> lock(update_mutex_);
+                update_profiler_.BeginFrame();
+
+                DrainUpdateEvents();
+
+                const double time = GetTime();
+                const double delta = time - last_time;
+                last_time = time;
+
+                if (specification_.fixed_timestep_enabled)
+                {
+                    FixedUpdateLayers(delta, false);
+                }
+                UpdateLayers(TimeStep(std::clamp(delta, 0.0, 0.0333)), false);
+
+                update_profiler_.EndFrame();
+            }
+            update_tick_count_.fetch_add(1, std::memory_order_relaxed);
+
+            if (tick_interval > Clock::duration::zero())
+            {
+                next_tick = std::max(next_tick + tick_interval, Clock::now());
+                std::this_thread::sleep_until(next_tick);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void Application::WaitForRedraw()
     {
-        for (auto &layer : layer_stack_)
+        FLUX_TRACE_SCOPE("WaitForRedraw");
+        if (NeedsRedraw())
         {
-            layer->OnDetach();
+            return;
         }
-        layer_stack_.clear();
 
+        if (minimized_)
+        {
+            glfwWaitEvents();
+            return;
+        }
+
+        // Any event (on any viewport window) or RequestRedraw() ends the wait early
+        const double timeout = specification_.lazy_idle_refresh_seconds;
+        const double wait_start = GetTime();
+        glfwWaitEventsTimeout(timeout);
+        if (GetTime() - wait_start < timeout)
+        {
+            redraw_frames_ = std::max(redraw_frames_, specification_.lazy_extra_frames);
+        }
+    }
+
+    bool Application::NeedsRedraw()
+    {
+        bool needs_redraw = redraw_requested_.exchange(false);
+
+        if (redraw_frames_ > 0)
+        {
+            --redraw_frames_;
+            needs_redraw = true;
+        }
+
+        if (needs_redraw)
+        {
+            return true;
+        }
+
+        // Text input needs frames for the blinking caret, budgeted uploads need frames too
+        if (ImGui::GetIO().WantTextInput || texture_manager_->HasPendingUploads())
+        {
+            return true;
+        }
+
+        const std::vector<Layer *> &layers = layer_stack_.GetLayers();
+        return std::any_of(layers.begin(), layers.end(),
+            [](const Layer *layer) { return layer->IsAnimating(); });
+    }
+
+    bool Application::CheckDrawnOutsideImGui()
+    {
+        // Anything that may have changed pixels outside ImGui's draw data
+        const uint64_t binds = render_target_pool_.GetStats().binds;
+        const uint64_t uploaded = texture_manager_->GetStats().uploaded_bytes_total;
+        const bool drawn = frame_invalidated_.exchange(false) || binds != render_target_binds_ ||
+                           uploaded != texture_uploaded_bytes_ ||
+                           renderer2d_.HasDrawnThisFrame();
+        render_target_binds_ = binds;
+        texture_uploaded_bytes_ = uploaded;
+        return drawn;
+    }
+
+    void Application::RenderDrawData(bool drawn_outside_imgui)
+    {
+        ImDrawData *draw_data = ImGui::GetDrawData();
+        if (!specification_.reuse_unchanged_frames || !draw_data)
+        {
+            DrawImGui(draw_data);
+            return;
+        }
+
+        if (drawn_outside_imgui)
+        {
+            frame_cache_.Invalidate();
+        }
+
+        const uint32_t width =
+            static_cast<uint32_t>(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+        const uint32_t height =
+            static_cast<uint32_t>(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+        const uint64_t hash = frame_cache_.Hash(*draw_data);
+        if (!frame_cache_.Present(hash, width, height))
+        {
+            DrawImGui(draw_data);
+            frame_cache_.Store(hash, width, height);
+        }
+    }
+
+    void Application::DrawImGui(ImDrawData *draw_data)
+    {
+        // The Flux renderer declines when it could not be created
+        if (specification_.imgui_renderer == ImGuiRendererBackend::Flux &&
+            imgui_renderer_.RenderDrawData(draw_data))
+        {
+            return;
+        }
+        ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+    }
+
+    void Application::RequestRedraw()
+    {
+        redraw_requested_.store(true);
+        glfwPostEmptyEvent();
+    }
+
+    Application &Application::Get()
+    {
+        return *s_application_instance;
+    }
+
+    void Application::FixedUpdateLayers(double frame_time, bool render_thread)
+    {
+        const double step = specification_.fixed_timestep;
+        if (step <= 0.0)
+        {
+            return;
+        }
+
+        FrameProfiler &profiler = render_thread ? profiler_ : update_profiler_;
+        ProfileScope phase_scope(profiler, profile_phases_.fixed_update);
+        fixed_accumulator_ += frame_time;
+
+        uint32_t steps = 0;
+        while (fixed_accumulator_ >= step)
+        {
+            if (steps >= specification_.max_fixed_steps_per_frame)
+            {
+                // Drop the backlog instead of falling further behind every frame
+                fixed_accumulator_ = std::fmod(fixed_accumulator_, step);
+                break;
+            }
+
+            for (Layer *layer : layer_stack_.GetFixedUpdateLayers())
+            {
+                ProfileScope scope(profiler, layer->fixed_update_scope_);
+                layer->OnFixedUpdate(TimeStep(step));
+            }
+            fixed_accumulator_ -= step;
+            ++steps;
+        }
+
+        interpolation_alpha_.store(static_cast<float>(fixed_accumulator_ / step),
+                                   std::memory_order_relaxed);
+    }
+
+    void Application::UpdateLayers(TimeStep timestep, bool render_thread)
+    {
+        // GPU timing only where the GL context is current
+        FrameProfiler &profiler = render_thread ? profiler_ : update_profiler_;
+        GpuProfiler *gpu_profiler = render_thread ? &gpu_profiler_ : nullptr;
+
+        ProfileScope phase_scope(profiler, profile_phases_.update);
+        GpuProfileScope gpu_phase_scope(gpu_profiler, profile_phases_.update);
+
+        if (job_system_ && layer_stack_.HasParallelUpdate())
+        {
+            ScheduleLayerUpdates(timestep, profiler, gpu_profiler);
+        }
+        else
+        {
+            for (Layer *layer : layer_stack_.GetUpdateLayers())
+            {
+                ProfileScope scope(profiler, layer->update_scope_);
+                GpuProfileScope gpu_scope(gpu_profiler, layer->update_scope_);
+                layer->OnUpdate(timestep);
+            }
+        }
+
+        // Parallel layers and jobs submitted from OnUpdate join before the ImGui phase
+        if (job_system_)
+        {
+            job_system_->Wait(update_jobs_);
+        }
+    }
+
+    void Application::ScheduleLayerUpdates(TimeStep timestep, FrameProfiler &profiler,
+                                           GpuProfiler *gpu_profiler)
+    {
+        // Indices below are into the update dispatch list, which only holds loaded
+        // layers overriding OnUpdate; dependencies on anything else are already gone
+        const std::vector<Layer *> &layers = layer_stack_.GetUpdateLayers();
+        const size_t count = layers.size();
+        update_handles_.assign(count, JobHandle());
+        update_started_.assign(count, false);
+
+        auto dependencies_started = [this](size_t index)
+        {
+            for (uint32_t dependency : layer_stack_.GetUpdateDependencies(index))
+            {
+                if (!update_started_[dependency])
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        auto schedule_parallel = [this, &layers, timestep, &profiler](size_t index)
+        {
+            dependency_handles_.clear();
+            for (uint32_t dependency : layer_stack_.GetUpdateDependencies(index))
+            {
+                if (update_handles_[dependency].IsValid())
+                {
+                    dependency_handles_.push_back(update_handles_[dependency]);
+                }
+            }
+
+            Layer *layer = layers[index];
+            update_handles_[index] = job_system_->Schedule(
+                [layer, timestep, &profiler]()
+                {
+                    ProfileScope scope(profiler, layer->update_scope_);
+                    layer->OnUpdate(timestep);
+                },
+                dependency_handles_, &update_jobs_);
+            update_started_[index] = true;
+        };
+
+        // Parallel layers are released as soon as everything they depend on has been
+        // scheduled (parallel) or has run (main thread)
+        auto schedule_ready = [&]()
+        {
+            bool progress = true;
+            while (progress)
+            {
+                progress = false;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (layers[i]->IsParallelUpdate() && !update_started_[i] &&
+                        dependencies_started(i))
+                    {
+                        schedule_parallel(i);
+                        progress = true;
+                    }
+                }
+            }
+        };
+
+        auto run_main_thread = [&](size_t index)
+        {
+            for (uint32_t dependency : layer_stack_.GetUpdateDependencies(index))
+            {
+                if (update_handles_[dependency].IsValid())
+                {
+                    job_system_->Wait(update_handles_[dependency]);
+                }
+            }
+
+            Layer &layer = *layers[index];
+            {
+                ProfileScope scope(profiler, layer.update_scope_);
+                GpuProfileScope gpu_scope(gpu_profiler, layer.update_scope_);
+                layer.OnUpdate(timestep);
+            }
+            update_started_[index] = true;
+        };
+
+        schedule_ready();
+
+        // Main-thread layers run in stack order, each deferred until every layer it
+        // depends on has run or been scheduled, so a pass runs what became ready
+        bool progress = true;
+        while (progress)
+        {
+            progress = false;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!layers[i]->IsParallelUpdate() && !update_started_[i] &&
+                    dependencies_started(i))
+                {
+                    run_main_thread(i);
+                    schedule_ready();
+                    progress = true;
+                }
+            }
+        }
+
+        // Only dependency cycles are left: run them unordered rather than never
+        size_t unordered = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (update_started_[i])
+            {
+                continue;
+            }
+            layers[i]->IsParallelUpdate() ? schedule_parallel(i) : run_main_thread(i);
+            ++unordered;
+        }
+        if (unordered > 0 && !dependency_cycle_warned_)
+        {
+            std::fprintf(stderr,
+                         "[Flux] Layer update dependencies form a cycle, %zu layers run "
+                         "unordered\n",
+                         unordered);
+            dependency_cycle_warned_ = true;
+        }
+    }
+
+    JobHandle Application::SubmitUpdateJob(JobSystem::Job job,
+                                           std::initializer_list<JobHandle> dependencies)
+    {
+        return job_system_->Schedule(std::move(job), dependencies, &update_jobs_);
+    }
+
+    void Application::RenderLayersUI()
+    {
+        ProfileScope phase_scope(profiler_, profile_phases_.render_ui);
+        for (Layer *layer : layer_stack_.GetRenderUILayers())
+        {
+            ProfileScope scope(profiler_, layer->render_ui_scope_);
+            layer->OnRenderUI();
+        }
+    }
+
+    void Application::Shutdown()
+    {
+        WaitForAsyncLoads();
+        layer_stack_.Clear([this](Layer &layer) { DetachLayer(layer); });
+
+        if (texture_manager_)
+        {
+            texture_manager_->Shutdown();
+        }
+        frame_cache_.Shutdown();
+        render_target_pool_.Shutdown();
+        renderer2d_.Shutdown();
+        imgui_renderer_.Shutdown();
+        viewport_renderer_.Shutdown();
+        gpu_profiler_.Shutdown();
+        frame_pacer_.Shutdown();
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
         ImGui::DestroyContext();
+        font_atlas_.reset();
 
         if (platform_ && platform_->window_handle)
         {
+            DestroyHeadlessFramebuffer();
             glfwDestroyWindow(platform_->window_handle);
             platform_->window_handle = nullptr;
         }
@@ -380,6 +1404,22 @@ namespace flux
         platform_.reset();
     }
 
+    bool Application::DumpTrace(const std::string &path) const
+    {
+#if defined(FLUX_ENABLE_TRACING)
+        if (!Tracer::Get().WriteChromeTrace(path, specification_.trace_dump_seconds))
+        {
+            std::fprintf(stderr, "[Flux] Failed to write trace %s\n", path.c_str());
+            return false;
+        }
+        std::fprintf(stderr, "[Flux] Trace written to %s\n", path.c_str());
+        return true;
+#else
+        std::fprintf(stderr, "[Flux] Tracing is disabled, build with FLUX_ENABLE_TRACING\n");
+        return false;
+#endif
+    }
+
     void *Application::GetNativeWindow() const
     {
         if (!platform_)
@@ -389,66 +1429,206 @@ namespace flux
         return platform_->window_handle;
     }
 
-    float Application::GetTime() const
+    double Application::GetTime() const
+    {
+        return glfwGetTime();
+    }
+
+    LayerHandle Application::AddLayer(std::unique_ptr<Layer> layer, uint32_t hooks,
+                                      bool overlay)
+    {
+        std::lock_guard<std::recursive_mutex> lock(update_mutex_);
+        const LayerHandle handle = layer_stack_.Push(std::move(layer), hooks, overlay);
+        if (!defer_layer_changes_)
+        {
+            ApplyLayerChanges();
+        }
+        return handle;
+    }
+
+    void Application::ApplyLayerChanges()
+    {
+        // Async loads complete outside the lock, the layers are not in any dispatch
+        // list yet so the update thread cannot reach them
+        const bool loads_finished = FinishLayerLoads();
+        if (!loads_finished && !layer_stack_.HasPending())
+        {
+            return;
+        }
+
+        std::lock_guard<std::recursive_mutex> lock(update_mutex_);
+        if (layer_stack_.HasPending())
+        {
+            layer_stack_.ApplyPending([this](Layer &layer) { AttachLayer(layer); },
+                                      [this](Layer &layer) { DetachLayer(layer); });
+        }
+        else
+        {
+            layer_stack_.RebuildDispatchLists();
+        }
+    }
+
+    void Application::AttachLayer(Layer &layer)
     {
-        return static_cast<float>(glfwGetTime());
+        RegisterLayerScopes(layer);
+        {
+            StartupTraceScope scope(startup_trace_, layer.GetName() + ".OnAttach");
+            FLUX_TRACE_SCOPE_DYNAMIC(layer.GetName() + ".OnAttach");
+            layer.OnAttach();
+        }
+        StartLayerLoad(layer);
+    }
+
+    void Application::DetachLayer(Layer &layer)
+    {
+        WaitForLayerLoad(layer);
+        FLUX_TRACE_SCOPE_DYNAMIC(layer.GetName() + ".OnDetach");
+        layer.OnDetach();
     }
 
-    void Application::PushLayer(std::unique_ptr<Layer> layer)
+    void Application::StartLayerLoad(Layer &layer)
     {
-        if (!layer)
+        if (!layer.IsAsyncLoad() || !job_system_)
         {
             return;
         }
-        layer->OnAttach();
-        layer_stack_.emplace(layer_stack_.begin() + layer_insert_index_, std::move(layer));
-        layer_insert_index_++;
+
+        layer.loaded_.store(false, std::memory_order_release);
+        ++pending_layer_loads_;
+        Layer *target = &layer;
+        layer.load_job_ = job_system_->Schedule(
+            [this, target]()
+            {
+                {
+                    StartupTraceScope scope(startup_trace_, target->GetName() + ".OnLoadAsync");
+                    FLUX_TRACE_SCOPE_DYNAMIC(target->GetName() + ".OnLoadAsync");
+                    target->OnLoadAsync();
+                }
+                RequestRedraw();
+            });
     }
 
-    void Application::PushOverlay(std::unique_ptr<Layer> overlay)
+    bool Application::FinishLayerLoads()
     {
-        if (!overlay)
+        if (pending_layer_loads_ == 0)
+        {
+            return false;
+        }
+
+        bool finished = false;
+        for (Layer *layer : layer_stack_.GetLayers())
+        {
+            if (!layer->load_job_.IsValid() || !layer->load_job_.IsDone())
+            {
+                continue;
+            }
+
+            {
+                StartupTraceScope scope(startup_trace_, layer->GetName() + ".OnLoadComplete");
+                FLUX_TRACE_SCOPE_DYNAMIC(layer->GetName() + ".OnLoadComplete");
+                layer->OnLoadComplete();
+            }
+            layer->load_job_ = JobHandle();
+            layer->loaded_.store(true, std::memory_order_release);
+            --pending_layer_loads_;
+            finished = true;
+        }
+        return finished;
+    }
+
+    void Application::WaitForLayerLoad(Layer &layer)
+    {
+        if (!layer.load_job_.IsValid())
         {
             return;
         }
-        overlay->OnAttach();
-        layer_stack_.emplace_back(std::move(overlay));
+
+        // Detached before OnLoadComplete, which is skipped
+        job_system_->Wait(layer.load_job_);
+        layer.load_job_ = JobHandle();
+        --pending_layer_loads_;
     }
 
-    void Application::PopLayer(Layer *layer)
+    void Application::WaitForAsyncLoads()
     {
-        auto it = std::find_if(layer_stack_.begin(),
-            layer_stack_.begin() + layer_insert_index_,
-            [layer](const std::unique_ptr<Layer> &l)
-            { return l.get() == layer; });
+        if (!job_system_)
+        {
+            return;
+        }
+
+        job_system_->Wait(font_job_);
+        for (Layer *layer : layer_stack_.GetLayers())
+        {
+            WaitForLayerLoad(*layer);
+        }
+    }
+
+    ProfileScopeId Application::RegisterProfileScope(const std::string &name)
+    {
+        // Both profilers see the same registration order, so ids match
+        update_profiler_.RegisterScope(name);
+        return profiler_.RegisterScope(name);
+    }
+
+    void Application::RegisterLayerScopes(Layer &layer)
+    {
+        // Scopes are shared by name. A second layer with the same name gets its own,
+        // two parallel updates must never add to one scope from two workers.
+        std::string name = layer.GetName();
+        if (layer_stack_.FindByName(name) != &layer)
+        {
+            name += "#" + std::to_string(layer.GetHandle().index);
+        }
+
+        layer.update_scope_ = RegisterProfileScope(name + ".OnUpdate");
+        if (specification_.fixed_timestep_enabled)
+        {
+            layer.fixed_update_scope_ = RegisterProfileScope(name + ".OnFixedUpdate");
+        }
+        layer.render_ui_scope_ = RegisterProfileScope(name + ".OnRenderUI");
+        layer.events_trace_name_ = Tracer::Get().Intern(name + ".OnEvents");
+    }
 
-        if (it != layer_stack_.begin() + layer_insert_index_)
+    std::unique_ptr<RenderTarget> Application::CreateRenderTarget(
+        const RenderTargetSpecification &specification)
+    {
+        RenderTargetSpecification resolved = specification;
+        if (resolved.samples < 0)
         {
-            (*it)->OnDetach();
-            layer_stack_.erase(it);
-            layer_insert_index_--;
+            resolved.samples = specification_.msaa_samples;
+        }
+        return std::make_unique<RenderTarget>(render_target_pool_, resolved);
+    }
+
+    void Application::PopLayer(LayerHandle handle)
+    {
+        std::lock_guard<std::recursive_mutex> lock(update_mutex_);
+        if (layer_stack_.Remove(handle) && !defer_layer_changes_)
+        {
+            ApplyLayerChanges();
+        }
+    }
+
+    void Application::PopLayer(Layer *layer)
+    {
+        if (layer)
+        {
+            PopLayer(layer->GetHandle());
         }
     }
 
     Layer *Application::GetLayer(size_t index)
     {
-        if (index >= layer_stack_.size())
+        if (index >= layer_stack_.GetSize())
         {
             return nullptr;
         }
-        return layer_stack_[index].get();
+        return layer_stack_.GetLayers()[index];
     }
 
     Layer *Application::GetLayerByName(std::string_view name)
     {
-        for (auto &layer : layer_stack_)
-        {
-            if (layer->GetName() == name)
-            {
-                return layer.get();
-            }
-        }
-        return nullptr;
+        return layer_stack_.FindByName(name);
     }
 
     void Application::SetMenubarCallback(std::function<void()> callback)
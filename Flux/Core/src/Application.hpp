@@ -4,16 +4,41 @@
 #ifndef FLUX_CORE_SRC_APPLICATION_HPP_
 #define FLUX_CORE_SRC_APPLICATION_HPP_
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 
+#include "AllocationTracker.hpp"
 #include "Event.hpp"
+#include "EventQueue.hpp"
+#include "FontAtlasCache.hpp"
+#include "FrameArena.hpp"
+#include "FrameCache.hpp"
+#include "FramePacer.hpp"
+#include "FrameProfiler.hpp"
+#include "GpuProfiler.hpp"
+#include "ImGuiRenderer.hpp"
+#include "JobSystem.hpp"
 #include "Layer.hpp"
+#include "LayerStack.hpp"
+#include "RenderTarget.hpp"
+#include "Renderer2D.hpp"
+#include "SpscQueue.hpp"
+#include "StartupTrace.hpp"
+#include "TextureManager.hpp"
 #include "TimeStep.hpp"
+#include "Trace.hpp"
+#include "ViewportRenderer.hpp"
 
 namespace flux
 {
@@ -46,7 +71,95 @@ namespace flux
         float imgui_merge_font_size = 16.0f;
 
         bool imgui_enable_merge_font = false;
+        // Baked atlas cache file, empty = rasterize on every start. Unused with
+        // ImGui 1.92+, which loads glyphs on demand instead.
+        std::string imgui_font_cache_path;
         void *platform_context = nullptr;
+
+        // Headless configuration: hidden window rendering into an offscreen
+        // framebuffer, falls back to GLFW's null platform + OSMesa if no display
+        bool headless = false;
+        uint64_t max_frames = 0;        // 0 = unlimited
+        double max_run_seconds = 0.0;   // 0 = unlimited
+
+        // Fixed-timestep simulation, drives Layer::OnFixedUpdate
+        bool fixed_timestep_enabled = false;
+        double fixed_timestep = 1.0 / 60.0;
+        uint32_t max_fixed_steps_per_frame = 8; // Spiral-of-death guard
+
+        // Merge consecutive mouse move / resize / scroll events within a frame
+        bool coalesce_events = true;
+
+        // Frame pacing and latency
+        float target_fps = 0.0f;           // 0 = uncapped, hybrid sleep/spin otherwise
+        bool adaptive_vsync = false;       // Swap interval -1 where swap_control_tear exists
+        bool late_input_sampling = false;  // Poll events right before the frame, not after swap
+        uint32_t max_frames_in_flight = 0; // 0 = driver default, otherwise fence-throttled
+
+        // Run OnEvent/OnFixedUpdate/OnUpdate on a dedicated update thread at its own
+        // rate. The main thread keeps GLFW, GL and ImGui (OnRenderUI). Change the
+        // layer stack from the main thread only while it is running.
+        bool threaded_update = false;
+        double update_rate_hz = 120.0; // 0 = unthrottled
+
+        // Initial size of the per-frame arena, it grows to the peak frame by itself
+        size_t frame_arena_bytes = 1024 * 1024;
+
+        // Job system, 0 = hardware_concurrency - 1 workers
+        uint32_t worker_threads = 0;
+
+        // Images decode on the job system, at most this many bytes reach the GPU per frame
+        size_t texture_upload_budget_bytes = 8 * 1024 * 1024;
+        // Above this many resident texture bytes, textures not drawn for
+        // texture_eviction_frames frames are evicted least recently used first
+        size_t texture_cache_budget_bytes = 512 * 1024 * 1024;
+        uint32_t texture_eviction_frames = 300;
+        bool texture_mipmaps = true;
+        // Decoded mip chains are kept here across runs, empty = no disk cache
+        std::string texture_disk_cache_directory;
+
+        // Power saving: when nothing changed, sleep in glfwWaitEventsTimeout until
+        // input arrives, RequestRedraw() is called or a layer is animating
+        bool lazy_rendering = false;
+        double lazy_idle_refresh_seconds = 1.0; // Upper bound on the sleep
+        uint32_t lazy_extra_frames = 3;          // Frames rendered after input so ImGui settles
+
+        // Skip the ImGui draw and present a stored copy when the draw data hashes
+        // the same as the previous frame's and no render target, Renderer2D draw or
+        // texture upload happened. Layers drawing into the window with raw GL must
+        // call InvalidateFrame(). Ignored with msaa_samples.
+        bool reuse_unchanged_frames = false;
+
+        // Renderer for the main viewport's ImGui draw data. Flux streams it through
+        // persistently mapped buffers with one indirect draw per batch and needs
+        // OpenGL 4.4, below that the stock backend is used. Can be switched at run
+        // time with SetImGuiRenderer().
+        ImGuiRendererBackend imgui_renderer = ImGuiRendererBackend::Stock;
+
+        // Secondary viewport windows are always drawn with swap interval 0, only the
+        // main window waits for vsync, and minimized or hidden ones are skipped. This
+        // also skips windows whose draw data did not change, under the same rules
+        // as reuse_unchanged_frames.
+        bool skip_unchanged_viewports = false;
+
+        // Init phases, font loading and async layer loads up to the first frame with
+        // all layers loaded, written as Chrome trace JSON. Empty = not written.
+        std::string startup_trace_path;
+        // Prints startup timings, the font atlas build and the time to first frame, to
+        // stderr. Always available from GetFontAtlasStats() and GetTimeToFirstFrameMs().
+        bool log_startup_stats = false;
+
+        // Timeline tracing, needs the FLUX_ENABLE_TRACING CMake option. The key (a
+        // GLFW key code such as GLFW_KEY_F12, 0 = none) writes the last
+        // trace_dump_seconds of every thread to trace_dump_path.
+        int trace_dump_key = 0;
+        std::string trace_dump_path = "flux_trace.json";
+        double trace_dump_seconds = 10.0;
+
+        // Profiling configuration
+        bool profiler_enabled = true;
+        bool profiler_overlay = false;
+        float profiler_frame_budget_ms = 16.6f;
     };
 
     class Application
@@ -62,20 +175,140 @@ namespace flux
 
         void Run();
 
-        // Layer management with ownership control
-        void PushLayer(std::unique_ptr<Layer> layer);
-        void PushOverlay(std::unique_ptr<Layer> overlay);
+        // Layer management with ownership control. While Run() is executing, pushes
+        // and pops take effect at the start of the next frame, so any layer callback
+        // may call them. Layers are only visited for the callbacks their type
+        // overrides, as seen from the pointer's static type.
+        template <typename T, typename = std::enable_if_t<std::is_base_of_v<Layer, T>>>
+        LayerHandle PushLayer(std::unique_ptr<T> layer)
+        {
+            const uint32_t hooks = GetHooksOf(layer.get());
+            return AddLayer(std::move(layer), hooks, false);
+        }
+        template <typename T, typename = std::enable_if_t<std::is_base_of_v<Layer, T>>>
+        LayerHandle PushOverlay(std::unique_ptr<T> overlay)
+        {
+            const uint32_t hooks = GetHooksOf(overlay.get());
+            return AddLayer(std::move(overlay), hooks, true);
+        }
+        void PopLayer(LayerHandle handle);
         void PopLayer(Layer *layer);
+        [[nodiscard]] Layer *GetLayer(LayerHandle handle) const { return layer_stack_.Get(handle); }
         [[nodiscard]] Layer *GetLayer(size_t index);
         [[nodiscard]] Layer *GetLayerByName(std::string_view name);
-        [[nodiscard]] size_t GetLayerCount() const { return layer_stack_.size(); }
+        [[nodiscard]] size_t GetLayerCount() const { return layer_stack_.GetSize(); }
 
         void SetMenubarCallback(std::function<void()> callback);
 
         [[nodiscard]] void *GetNativeWindow() const;
-        [[nodiscard]] float GetTime() const;
+        [[nodiscard]] double GetTime() const;
+        // Fraction of a fixed step left in the accumulator, for render interpolation
+        [[nodiscard]] float GetInterpolationAlpha() const
+        {
+            return interpolation_alpha_.load(std::memory_order_relaxed);
+        }
+        [[nodiscard]] uint64_t GetFrameCount() const { return frame_count_; }
+        [[nodiscard]] bool IsHeadless() const { return specification_.headless; }
         void Close();
 
+        // Thread-safe, wakes the loop when lazy rendering is sleeping
+        void RequestRedraw();
+        // Thread-safe, the frame being built is drawn in full even if ImGui's draw
+        // data did not change
+        void InvalidateFrame() { frame_invalidated_.store(true); }
+
+        // Queues an event as if the window had produced it, for scripted input. Main
+        // thread only; a full queue is dispatched to the layers right away. Posted from
+        // an event handler, it is delivered with the next batch.
+        void PostEvent(const EventVariant &event) { QueueEvent(event); }
+
+        [[nodiscard]] static Application &Get();
+
+        [[nodiscard]] JobSystem &GetJobSystem() { return *job_system_; }
+        // Jobs submitted here are joined before the ImGui phase of the current frame
+        JobHandle SubmitUpdateJob(JobSystem::Job job,
+                                  std::initializer_list<JobHandle> dependencies = {});
+
+        // Linear allocator reset at the top of every frame. Render thread only:
+        // OnRenderUI, and OnUpdate unless it runs on the update thread or a worker.
+        [[nodiscard]] FrameArena &GetFrameAllocator() { return frame_arena_; }
+        // Heap allocations of the previous frame, zero unless built with
+        // FLUX_TRACK_ALLOCATIONS
+        [[nodiscard]] const AllocationCounts &GetFrameAllocations() const
+        {
+            return frame_allocations_;
+        }
+
+        // Offscreen framebuffer for a viewport panel, GL thread only. samples = -1 takes
+        // msaa_samples from the specification.
+        [[nodiscard]] std::unique_ptr<RenderTarget> CreateRenderTarget(
+            const RenderTargetSpecification &specification = RenderTargetSpecification());
+        // Batched quads, lines and circles for layers drawing from the GL thread
+        [[nodiscard]] Renderer2D &GetRenderer2D() { return renderer2d_; }
+        [[nodiscard]] const RenderTargetPoolStats &GetRenderTargetStats() const
+        {
+            return render_target_pool_.GetStats();
+        }
+        [[nodiscard]] const FrameCacheStats &GetFrameCacheStats() const
+        {
+            return frame_cache_.GetStats();
+        }
+        // GL thread, takes effect from the next frame drawn
+        void SetImGuiRenderer(ImGuiRendererBackend backend)
+        {
+            specification_.imgui_renderer = backend;
+        }
+        [[nodiscard]] ImGuiRendererBackend GetImGuiRenderer() const
+        {
+            return specification_.imgui_renderer;
+        }
+        // Secondary viewport windows of the last frame with their CPU cost
+        [[nodiscard]] const ViewportRendererStats &GetViewportStats() const
+        {
+            return viewport_renderer_.GetStats();
+        }
+        // Of the last frame drawn by the Flux renderer
+        [[nodiscard]] const ImGuiRendererStats &GetImGuiRendererStats() const
+        {
+            return imgui_renderer_.GetStats();
+        }
+
+        [[nodiscard]] TextureManager &GetTextureManager() { return *texture_manager_; }
+        [[nodiscard]] const TextureManagerStats &GetTextureStats() const
+        {
+            return texture_manager_->GetStats();
+        }
+
+        [[nodiscard]] FrameProfiler &GetProfiler() { return profiler_; }
+        [[nodiscard]] const FrameProfiler &GetProfiler() const { return profiler_; }
+        [[nodiscard]] const GpuProfiler &GetGpuProfiler() const { return gpu_profiler_; }
+        // Scopes recorded on the update thread when threaded_update is enabled
+        [[nodiscard]] const FrameProfiler &GetUpdateProfiler() const { return update_profiler_; }
+        [[nodiscard]] uint64_t GetUpdateTickCount() const { return update_tick_count_.load(); }
+        [[nodiscard]] uint64_t GetCoalescedEventCount() const
+        {
+            return event_queues_[0].GetCoalescedCount() + event_queues_[1].GetCoalescedCount();
+        }
+        // Mouse moves and scrolls the update thread fell too far behind to receive
+        [[nodiscard]] uint64_t GetDroppedUpdateEventCount() const
+        {
+            return dropped_update_events_;
+        }
+        [[nodiscard]] const FramePacerStats &GetFramePacerStats() const
+        {
+            return frame_pacer_.GetStats();
+        }
+
+        // Measured during Init, the size is that of the atlas after startup
+        [[nodiscard]] const FontAtlasStats &GetFontAtlasStats() const { return font_stats_; }
+
+        [[nodiscard]] const StartupTrace &GetStartupTrace() const { return startup_trace_; }
+        // Chrome trace JSON of the last trace_dump_seconds, false when tracing is
+        // compiled out or the file cannot be written
+        bool DumpTrace(const std::string &path) const;
+        // From construction to the first SwapBuffers, 0 before the first frame
+        [[nodiscard]] double GetTimeToFirstFrameMs() const { return first_frame_ms_; }
+
         [[nodiscard]] const ApplicationSpecification &GetSpecification() const
         {
             return specification_;
@@ -84,28 +317,146 @@ namespace flux
         struct PlatformState;
 
     private:
+        // A subclass behind a base pointer may override more than the base does
+        template <typename T>
+        [[nodiscard]] static uint32_t GetHooksOf(const T *layer)
+        {
+            return layer && typeid(*layer) == typeid(T) ? GetLayerHooks<T>() : LayerHookAll;
+        }
+
         void Init();
         void Shutdown();
-        void OnEvent(Event &e);
+        void QueueEvent(const EventVariant &event);
+        void ProcessEvents();
+        void DispatchToLayers(EventSpan events);
+        void DrainUpdateEvents();
+        void ForwardToUpdateThread(const EventVariant &event);
+        void FlushUpdateEventOverflow();
         bool OnWindowClose(WindowCloseEvent &e);
         bool OnWindowResize(WindowResizeEvent &e);
 
+        bool CreatePlatformWindow();
+        void ConfigureSwapInterval();
+        void LoadFonts(ImFontAtlas &atlas);
+        void StartLayerLoad(Layer &layer);
+        [[nodiscard]] bool FinishLayerLoads();
+        void WaitForLayerLoad(Layer &layer);
+        void WaitForAsyncLoads();
+        void CompleteStartup();
+        void PollEvents();
+        bool CreateHeadlessFramebuffer();
+        void DestroyHeadlessFramebuffer();
         void SetupEventCallbacks();
+        LayerHandle AddLayer(std::unique_ptr<Layer> layer, uint32_t hooks, bool overlay);
+        void ApplyLayerChanges();
+        void AttachLayer(Layer &layer);
+        void DetachLayer(Layer &layer);
+        void RegisterLayerScopes(Layer &layer);
+        void WaitForRedraw();
+        [[nodiscard]] bool NeedsRedraw();
+        void FixedUpdateLayers(double frame_time, bool render_thread);
+        void UpdateLayers(TimeStep timestep, bool render_thread);
+        void ScheduleLayerUpdates(TimeStep timestep, FrameProfiler &profiler,
+                                  GpuProfiler *gpu_profiler);
+        void StartUpdateThread();
+        void StopUpdateThread();
+        void UpdateThreadLoop();
+        ProfileScopeId RegisterProfileScope(const std::string &name);
+        void RenderLayersUI();
+        [[nodiscard]] bool CheckDrawnOutsideImGui();
+        void RenderDrawData(bool drawn_outside_imgui);
+        void DrawImGui(ImDrawData *draw_data);
 
         ApplicationSpecification specification_;
+        // Constructed before Init, trace times are relative to it
+        StartupTrace startup_trace_;
+        double first_frame_ms_ = 0.0;
         bool running_ = false;
         bool minimized_ = false;
 
-        std::vector<std::unique_ptr<Layer>> layer_stack_;
-        size_t layer_insert_index_ = 0;
+        std::atomic<bool> redraw_requested_{false};
+        uint32_t redraw_frames_ = 0;
+
+        LayerStack layer_stack_;
+        // Set while Run() is executing, layer changes wait for the next frame
+        bool defer_layer_changes_ = false;
         std::function<void()> menubar_callback_;
 
-        float time_step_ = 0.0f;
-        float frame_time_ = 0.0f;
-        float last_frame_time_ = 0.0f;
+        // Filled by the GLFW callbacks, consumed once per frame. The two swap roles
+        // for each batch, so events posted while one is dispatched wait in the other.
+        std::array<EventQueue, 2> event_queues_;
+        EventQueue *event_queue_ = &event_queues_[0];
+        bool dispatching_events_ = false;
+        // Posted during dispatch once the other queue is full, in order
+        std::vector<EventVariant> event_spill_;
+
+        double time_step_ = 0.0;
+        double frame_time_ = 0.0;
+        double last_frame_time_ = 0.0;
+        double fixed_accumulator_ = 0.0;
+        std::atomic<float> interpolation_alpha_{0.0f};
         float ui_scale_ = 1.0f;
+        FontAtlasStats font_stats_;
+        // Built on a worker during Init and shared with the ImGui context, which does
+        // not own it
+        std::unique_ptr<ImFontAtlas> font_atlas_;
+        JobHandle font_job_;
+        uint64_t frame_count_ = 0;
 
         std::unique_ptr<PlatformState> platform_;
+
+        std::unique_ptr<JobSystem> job_system_;
+        JobGroup update_jobs_;
+        std::vector<JobHandle> update_handles_;
+        std::vector<JobHandle> dependency_handles_;
+        std::vector<bool> update_started_;
+        bool dependency_cycle_warned_ = false;
+
+        std::unique_ptr<TextureManager> texture_manager_;
+        RenderTargetPool render_target_pool_;
+        Renderer2D renderer2d_;
+        FrameCache frame_cache_{render_target_pool_};
+        ImGuiRenderer imgui_renderer_;
+        ViewportRenderer viewport_renderer_;
+        std::atomic<bool> frame_invalidated_{false};
+        uint64_t render_target_binds_ = 0;
+        uint64_t texture_uploaded_bytes_ = 0;
+        FrameArena frame_arena_;
+        AllocationCounts frame_allocations_;
+        uint32_t pending_layer_loads_ = 0;
+
+        // Threaded update: the update thread holds update_mutex_ for each tick, layer
+        // stack changes take it too
+        std::thread update_thread_;
+        std::atomic<bool> update_thread_running_{false};
+        std::recursive_mutex update_mutex_;
+        SpscQueue<EventVariant, 4096> update_events_;
+        EventQueue update_event_queue_;
+        // Main thread: events update_events_ had no room for, retried in order each frame
+        std::vector<EventVariant> update_event_overflow_;
+        uint64_t dropped_update_events_ = 0;
+        std::atomic<uint64_t> update_tick_count_{0};
+
+        struct ProfilePhases
+        {
+            ProfileScopeId event_poll = kInvalidProfileScope;
+            ProfileScopeId event_dispatch = kInvalidProfileScope;
+            ProfileScopeId texture_upload = kInvalidProfileScope;
+            ProfileScopeId clear = kInvalidProfileScope;
+            ProfileScopeId fixed_update = kInvalidProfileScope;
+            ProfileScopeId update = kInvalidProfileScope;
+            ProfileScopeId render_ui = kInvalidProfileScope;
+            ProfileScopeId imgui_render = kInvalidProfileScope;
+            ProfileScopeId render_draw_data = kInvalidProfileScope;
+            ProfileScopeId platform_windows = kInvalidProfileScope;
+            ProfileScopeId swap = kInvalidProfileScope;
+        };
+
+        FramePacer frame_pacer_;
+        FrameProfiler profiler_;
+        GpuProfiler gpu_profiler_;
+        FrameProfiler update_profiler_;
+        ProfilePhases profile_phases_;
     };
 
     std::unique_ptr<Application> CreateApplication();
@@ -7,6 +7,9 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace flux
 {
@@ -38,30 +41,62 @@ namespace flux
         EventCategoryMouseButton = 1 << 4
     };
 
+    // Event type and category live in the base object, so type checks and category
+    // filtering are plain loads instead of virtual calls
 #define EVENT_CLASS_TYPE(type)                                                                  \
-    [[nodiscard]] static EventType GetStaticType() { return EventType::type; }                  \
-    [[nodiscard]] virtual EventType GetEventType() const override { return GetStaticType(); }   \
-    [[nodiscard]] virtual const char *GetName() const override { return #type; }
+    static constexpr EventType kStaticType = EventType::type;                                   \
+    [[nodiscard]] static constexpr EventType GetStaticType() { return EventType::type; }
 
 #define EVENT_CLASS_CATEGORY(category)                                                          \
-    [[nodiscard]] virtual int GetCategoryFlags() const override { return category; }
+    static constexpr int kCategoryFlags = category;
+
+    [[nodiscard]] constexpr const char *GetEventTypeName(EventType type)
+    {
+        switch (type)
+        {
+        case EventType::WindowClose: return "WindowClose";
+        case EventType::WindowResize: return "WindowResize";
+        case EventType::WindowFocus: return "WindowFocus";
+        case EventType::WindowLostFocus: return "WindowLostFocus";
+        case EventType::WindowMoved: return "WindowMoved";
+        case EventType::KeyPressed: return "KeyPressed";
+        case EventType::KeyReleased: return "KeyReleased";
+        case EventType::KeyTyped: return "KeyTyped";
+        case EventType::MouseButtonPressed: return "MouseButtonPressed";
+        case EventType::MouseButtonReleased: return "MouseButtonReleased";
+        case EventType::MouseMoved: return "MouseMoved";
+        case EventType::MouseScrolled: return "MouseScrolled";
+        default: return "None";
+        }
+    }
 
     class Event
     {
     public:
-        virtual ~Event() = default;
-
         bool handled = false;
 
-        [[nodiscard]] virtual EventType GetEventType() const = 0;
-        [[nodiscard]] virtual const char *GetName() const = 0;
-        [[nodiscard]] virtual int GetCategoryFlags() const = 0;
-        [[nodiscard]] virtual std::string ToString() const { return GetName(); }
+        [[nodiscard]] EventType GetEventType() const { return type_; }
+        [[nodiscard]] const char *GetName() const { return GetEventTypeName(type_); }
+        [[nodiscard]] int GetCategoryFlags() const { return category_flags_; }
+
+        // Debug formatting only, allocates
+        [[nodiscard]] std::string ToString() const;
 
         [[nodiscard]] bool IsInCategory(EventCategory category) const
         {
-            return GetCategoryFlags() & category;
+            return category_flags_ & category;
         }
+
+    protected:
+        constexpr Event(EventType type, int category_flags)
+            : type_(type), category_flags_(category_flags)
+        {
+        }
+        ~Event() = default;
+
+    private:
+        EventType type_;
+        int category_flags_;
     };
 
     class EventDispatcher
@@ -72,7 +107,7 @@ namespace flux
         template <typename T, typename F>
         bool Dispatch(const F &func)
         {
-            if (event_.GetEventType() == T::GetStaticType())
+            if (event_.GetEventType() == T::kStaticType)
             {
                 event_.handled |= func(static_cast<T &>(event_));
                 return true;
@@ -89,14 +124,14 @@ namespace flux
     {
     public:
         WindowResizeEvent(uint32_t width, uint32_t height)
-            : width_(width), height_(height)
+            : Event(kStaticType, kCategoryFlags), width_(width), height_(height)
         {
         }
 
         [[nodiscard]] uint32_t GetWidth() const { return width_; }
         [[nodiscard]] uint32_t GetHeight() const { return height_; }
 
-        [[nodiscard]] std::string ToString() const override
+        [[nodiscard]] std::string ToString() const
         {
             return "WindowResizeEvent: " + std::to_string(width_) + ", " +
                    std::to_string(height_);
@@ -112,7 +147,7 @@ namespace flux
     class WindowCloseEvent : public Event
     {
     public:
-        WindowCloseEvent() = default;
+        WindowCloseEvent() : Event(kStaticType, kCategoryFlags) {}
 
         EVENT_CLASS_TYPE(WindowClose)
         EVENT_CLASS_CATEGORY(EventCategoryApplication)
@@ -127,7 +162,9 @@ namespace flux
         EVENT_CLASS_CATEGORY(EventCategoryKeyboard | EventCategoryInput)
 
     protected:
-        explicit KeyEvent(int keycode) : key_code_(keycode) {}
+        KeyEvent(EventType type, int keycode) : Event(type, kCategoryFlags), key_code_(keycode)
+        {
+        }
 
         int key_code_;
     };
@@ -136,13 +173,13 @@ namespace flux
     {
     public:
         KeyPressedEvent(int keycode, int repeat_count)
-            : KeyEvent(keycode), repeat_count_(repeat_count)
+            : KeyEvent(kStaticType, keycode), repeat_count_(repeat_count)
         {
         }
 
         [[nodiscard]] int GetRepeatCount() const { return repeat_count_; }
 
-        [[nodiscard]] std::string ToString() const override
+        [[nodiscard]] std::string ToString() const
         {
             return "KeyPressedEvent: " + std::to_string(key_code_) +
                    " (" + std::to_string(repeat_count_) + " repeats)";
@@ -157,9 +194,9 @@ namespace flux
     class KeyReleasedEvent : public KeyEvent
     {
     public:
-        explicit KeyReleasedEvent(int keycode) : KeyEvent(keycode) {}
+        explicit KeyReleasedEvent(int keycode) : KeyEvent(kStaticType, keycode) {}
 
-        [[nodiscard]] std::string ToString() const override
+        [[nodiscard]] std::string ToString() const
         {
             return "KeyReleasedEvent: " + std::to_string(key_code_);
         }
@@ -170,9 +207,9 @@ namespace flux
     class KeyTypedEvent : public KeyEvent
     {
     public:
-        explicit KeyTypedEvent(int keycode) : KeyEvent(keycode) {}
+        explicit KeyTypedEvent(int keycode) : KeyEvent(kStaticType, keycode) {}
 
-        [[nodiscard]] std::string ToString() const override
+        [[nodiscard]] std::string ToString() const
         {
             return "KeyTypedEvent: " + std::to_string(key_code_);
         }
@@ -184,12 +221,15 @@ namespace flux
     class MouseMovedEvent : public Event
     {
     public:
-        MouseMovedEvent(float x, float y) : mouse_x_(x), mouse_y_(y) {}
+        MouseMovedEvent(float x, float y)
+            : Event(kStaticType, kCategoryFlags), mouse_x_(x), mouse_y_(y)
+        {
+        }
 
         [[nodiscard]] float GetX() const { return mouse_x_; }
         [[nodiscard]] float GetY() const { return mouse_y_; }
 
-        [[nodiscard]] std::string ToString() const override
+        [[nodiscard]] std::string ToString() const
         {
             return "MouseMovedEvent: " + std::to_string(mouse_x_) + ", " +
                    std::to_string(mouse_y_);
@@ -206,14 +246,14 @@ namespace flux
     {
     public:
         MouseScrolledEvent(float x_offset, float y_offset)
-            : x_offset_(x_offset), y_offset_(y_offset)
+            : Event(kStaticType, kCategoryFlags), x_offset_(x_offset), y_offset_(y_offset)
         {
         }
 
         [[nodiscard]] float GetXOffset() const { return x_offset_; }
         [[nodiscard]] float GetYOffset() const { return y_offset_; }
 
-        [[nodiscard]] std::string ToString() const override
+        [[nodiscard]] std::string ToString() const
         {
             return "MouseScrolledEvent: " + std::to_string(x_offset_) + ", " +
                    std::to_string(y_offset_);
@@ -235,7 +275,9 @@ namespace flux
                              EventCategoryMouseButton)
 
     protected:
-        explicit MouseButtonEvent(int button) : button_(button) {}
+        MouseButtonEvent(EventType type, int button) : Event(type, kCategoryFlags), button_(button)
+        {
+        }
 
         int button_;
     };
@@ -243,9 +285,9 @@ namespace flux
     class MouseButtonPressedEvent : public MouseButtonEvent
     {
     public:
-        explicit MouseButtonPressedEvent(int button) : MouseButtonEvent(button) {}
+        explicit MouseButtonPressedEvent(int button) : MouseButtonEvent(kStaticType, button) {}
 
-        [[nodiscard]] std::string ToString() const override
+        [[nodiscard]] std::string ToString() const
         {
             return "MouseButtonPressedEvent: " + std::to_string(button_);
         }
@@ -256,9 +298,12 @@ namespace flux
     class MouseButtonReleasedEvent : public MouseButtonEvent
     {
     public:
-        explicit MouseButtonReleasedEvent(int button) : MouseButtonEvent(button) {}
+        explicit MouseButtonReleasedEvent(int button)
+            : MouseButtonEvent(kStaticType, button)
+        {
+        }
 
-        [[nodiscard]] std::string ToString() const override
+        [[nodiscard]] std::string ToString() const
         {
             return "MouseButtonReleasedEvent: " + std::to_string(button_);
         }
@@ -266,6 +311,69 @@ namespace flux
         EVENT_CLASS_TYPE(MouseButtonReleased)
     };
 
+    inline std::string Event::ToString() const
+    {
+        switch (type_)
+        {
+        case EventType::WindowResize:
+            return static_cast<const WindowResizeEvent &>(*this).ToString();
+        case EventType::KeyPressed:
+            return static_cast<const KeyPressedEvent &>(*this).ToString();
+        case EventType::KeyReleased:
+            return static_cast<const KeyReleasedEvent &>(*this).ToString();
+        case EventType::KeyTyped:
+            return static_cast<const KeyTypedEvent &>(*this).ToString();
+        case EventType::MouseMoved:
+            return static_cast<const MouseMovedEvent &>(*this).ToString();
+        case EventType::MouseScrolled:
+            return static_cast<const MouseScrolledEvent &>(*this).ToString();
+        case EventType::MouseButtonPressed:
+            return static_cast<const MouseButtonPressedEvent &>(*this).ToString();
+        case EventType::MouseButtonReleased:
+            return static_cast<const MouseButtonReleasedEvent &>(*this).ToString();
+        default:
+            return GetName();
+        }
+    }
+
+    // Value type holding any concrete event, used to queue events between threads
+    using EventVariant =
+        std::variant<WindowCloseEvent, WindowResizeEvent, KeyPressedEvent, KeyReleasedEvent,
+                     KeyTypedEvent, MouseButtonPressedEvent, MouseButtonReleasedEvent,
+                     MouseMovedEvent, MouseScrolledEvent>;
+
+    // Builds an overload set from lambdas for compile-time dispatch:
+    //   DispatchEvent(event, [](KeyPressedEvent &e) { ... }, [](MouseMovedEvent &e) { ... });
+    template <typename... Handlers>
+    struct EventHandlers : Handlers...
+    {
+        using Handlers::operator()...;
+    };
+    template <typename... Handlers>
+    EventHandlers(Handlers...) -> EventHandlers<Handlers...>;
+
+    // Handlers may take the concrete event, a const reference or a base class such as
+    // Event &. Event types no handler accepts are skipped at compile time.
+    template <typename... Handlers>
+    void DispatchEvent(EventVariant &event, Handlers &&...handlers)
+    {
+        EventHandlers overloads{std::forward<Handlers>(handlers)...};
+        std::visit(
+            [&overloads](auto &concrete)
+            {
+                if constexpr (std::is_invocable_v<decltype(overloads) &, decltype(concrete)>)
+                {
+                    overloads(concrete);
+                }
+            },
+            event);
+    }
+
+    [[nodiscard]] inline Event &GetEventBase(EventVariant &event)
+    {
+        return std::visit([](auto &concrete) -> Event & { return concrete; }, event);
+    }
+
 } // namespace flux
 
 #endif // FLUX_CORE_SRC_EVENT_HPP_
@@ -0,0 +1,101 @@
+// Copyright 2026 Beisent
+// Per-frame event queue for Flux framework
+
+#ifndef FLUX_CORE_SRC_EVENTQUEUE_HPP_
+#define FLUX_CORE_SRC_EVENTQUEUE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <variant>
+
+#include "Event.hpp"
+
+namespace flux
+{
+
+    // Non-owning view over a batch of queued events
+    class EventSpan
+    {
+    public:
+        EventSpan(EventVariant *data, size_t size) : data_(data), size_(size) {}
+
+        [[nodiscard]] EventVariant *begin() const { return data_; }
+        [[nodiscard]] EventVariant *end() const { return data_ + size_; }
+        [[nodiscard]] size_t size() const { return size_; }
+        [[nodiscard]] bool empty() const { return size_ == 0; }
+
+    private:
+        EventVariant *data_;
+        size_t size_;
+    };
+
+    // Fixed-capacity storage, events are collected during the frame and consumed in
+    // one batch. Consecutive mouse moves, resizes and scrolls can be merged.
+    class EventQueue
+    {
+    public:
+        static constexpr size_t kCapacity = 1024;
+
+        void SetCoalescing(bool enabled) { coalescing_ = enabled; }
+
+        // Returns false when full, the caller flushes and pushes again
+        bool Push(const EventVariant &event)
+        {
+            if (coalescing_ && size_ > 0 && TryCoalesce(events_[size_ - 1], event))
+            {
+                ++coalesced_count_;
+                return true;
+            }
+
+            if (size_ == kCapacity)
+            {
+                return false;
+            }
+            events_[size_++] = event;
+            return true;
+        }
+
+        void Clear() { size_ = 0; }
+
+        [[nodiscard]] EventSpan GetEvents() { return EventSpan(events_.data(), size_); }
+        [[nodiscard]] size_t GetSize() const { return size_; }
+        [[nodiscard]] bool IsEmpty() const { return size_ == 0; }
+        [[nodiscard]] uint64_t GetCoalescedCount() const { return coalesced_count_; }
+
+        // Merges event into last when both are mouse moves, resizes or scrolls
+        static bool TryCoalesce(EventVariant &last, const EventVariant &event)
+        {
+            if (last.index() != event.index())
+            {
+                return false;
+            }
+
+            if (std::holds_alternative<MouseMovedEvent>(event) ||
+                std::holds_alternative<WindowResizeEvent>(event))
+            {
+                last = event;
+                return true;
+            }
+
+            if (const auto *scroll = std::get_if<MouseScrolledEvent>(&event))
+            {
+                const auto &previous = std::get<MouseScrolledEvent>(last);
+                last = MouseScrolledEvent(previous.GetXOffset() + scroll->GetXOffset(),
+                                          previous.GetYOffset() + scroll->GetYOffset());
+                return true;
+            }
+
+            return false;
+        }
+
+    private:
+        std::array<EventVariant, kCapacity> events_{};
+        size_t size_ = 0;
+        bool coalescing_ = true;
+        uint64_t coalesced_count_ = 0;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_EVENTQUEUE_HPP_
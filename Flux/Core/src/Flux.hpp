@@ -6,8 +6,33 @@
 
 // Core
 #include "Application.hpp"
+#include "AllocationTracker.hpp"
+#include "FrameArena.hpp"
+#include "FrameCache.hpp"
 #include "Layer.hpp"
+#include "LayerStack.hpp"
 #include "TimeStep.hpp"
+#include "FramePacer.hpp"
+#include "JobSystem.hpp"
+#include "SpscQueue.hpp"
+#include "TripleBuffer.hpp"
+
+// Resources
+#include "ImGuiRenderer.hpp"
+#include "RenderTarget.hpp"
+#include "Renderer2D.hpp"
+#include "Texture.hpp"
+#include "TextureManager.hpp"
+#include "TimeSeries.hpp"
+#include "TimeSeriesPlot.hpp"
+#include "ViewportRenderer.hpp"
+
+// Profiling
+#include "FrameProfiler.hpp"
+#include "GpuProfiler.hpp"
+#include "ProfilerLayer.hpp"
+#include "StartupTrace.hpp"
+#include "Trace.hpp"
 
 // Events
 #include "Event.hpp"
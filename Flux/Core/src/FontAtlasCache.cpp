@@ -0,0 +1,319 @@
+// Copyright 2026 Beisent
+// FontAtlasCache implementation
+
+#include "FontAtlasCache.hpp"
+#include "MappedFile.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+namespace flux
+{
+
+    namespace
+    {
+        struct FileHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t key;
+            int32_t width;
+            int32_t height;
+            uint32_t font_count;
+            uint32_t line_uv_count;
+            ImVec2 uv_scale;
+            ImVec2 uv_white_pixel;
+            uint32_t custom_rect_count;
+            int32_t pack_id_mouse_cursors; // -1 with ImFontAtlasFlags_NoMouseCursors
+            int32_t pack_id_lines;
+        };
+
+        // Where the build packed a custom rect; ImGui finds the mouse cursor shapes
+        // through PackIdMouseCursors and Clear() drops them along with the fonts
+        struct CustomRectRecord
+        {
+            uint16_t x, y;
+            uint16_t width, height;
+        };
+
+        struct FontRecord
+        {
+            float size;
+            float ascent;
+            float descent;
+            uint32_t glyph_count;
+        };
+
+        struct GlyphRecord
+        {
+            uint32_t codepoint;
+            float advance_x;
+            float x0, y0, x1, y1;
+            float u0, v0, u1, v1;
+        };
+
+        // Bounds-checked cursor over the mapped file
+        class Reader
+        {
+        public:
+            Reader(const uint8_t *data, size_t size) : cursor_(data), end_(data + size) {}
+
+            template <typename T>
+            bool Read(T &value)
+            {
+                return ReadBytes(&value, sizeof(T));
+            }
+
+            bool ReadBytes(void *out, size_t size)
+            {
+                if (static_cast<size_t>(end_ - cursor_) < size)
+                {
+                    return false;
+                }
+                std::memcpy(out, cursor_, size);
+                cursor_ += size;
+                return true;
+            }
+
+        private:
+            const uint8_t *cursor_;
+            const uint8_t *end_;
+        };
+
+        template <typename T>
+        void Write(std::ofstream &file, const T &value)
+        {
+            file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+    } // namespace
+
+    FontAtlasCache::FontAtlasCache(std::string path)
+        : path_(std::move(path)), key_(0xcbf29ce484222325ull)
+    {
+        const int version = IMGUI_VERSION_NUM;
+        const int line_width_max = IM_DRAWLIST_TEX_LINES_WIDTH_MAX;
+        HashBytes(&version, sizeof(version));
+        HashBytes(&line_width_max, sizeof(line_width_max));
+        HashBytes(&kVersion, sizeof(kVersion));
+    }
+
+    bool FontAtlasCache::IsEnabled() const
+    {
+#if IMGUI_VERSION_NUM < 19200
+        return !path_.empty();
+#else
+        return false;
+#endif
+    }
+
+    void FontAtlasCache::HashBytes(const void *data, size_t size)
+    {
+        const auto *bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            key_ ^= bytes[i];
+            key_ *= 0x100000001b3ull;
+        }
+    }
+
+    void FontAtlasCache::AddSource(const std::string &font_path, const ImFontConfig &config,
+                                   const ImWchar *glyph_ranges)
+    {
+        HashBytes(font_path.data(), font_path.size());
+
+        // A missing file hashes as zero and fails later when ImGui loads it
+        std::error_code error;
+        const auto size = std::filesystem::file_size(font_path, error);
+        const uint64_t file_size = error ? 0 : static_cast<uint64_t>(size);
+        const auto modified = std::filesystem::last_write_time(font_path, error);
+        const int64_t modified_time =
+            error ? 0 : static_cast<int64_t>(modified.time_since_epoch().count());
+        HashBytes(&file_size, sizeof(file_size));
+        HashBytes(&modified_time, sizeof(modified_time));
+
+        HashBytes(&config.SizePixels, sizeof(config.SizePixels));
+        HashBytes(&config.OversampleH, sizeof(config.OversampleH));
+        HashBytes(&config.OversampleV, sizeof(config.OversampleV));
+        HashBytes(&config.PixelSnapH, sizeof(config.PixelSnapH));
+        HashBytes(&config.MergeMode, sizeof(config.MergeMode));
+        HashBytes(&config.GlyphMinAdvanceX, sizeof(config.GlyphMinAdvanceX));
+
+        // Ranges are zero-terminated pairs
+        for (const ImWchar *range = glyph_ranges; range && range[0]; range += 2)
+        {
+            HashBytes(range, sizeof(ImWchar) * 2);
+        }
+    }
+
+#if IMGUI_VERSION_NUM < 19200
+
+    bool FontAtlasCache::Load(ImFontAtlas &atlas) const
+    {
+        MappedFile mapping;
+        if (!IsEnabled() || !mapping.Open(path_))
+        {
+            return false;
+        }
+
+        Reader reader(mapping.GetData(), mapping.GetSize());
+        FileHeader header{};
+        if (!reader.Read(header) || header.magic != kMagic || header.version != kVersion ||
+            header.key != key_ || header.width <= 0 || header.height <= 0 ||
+            header.font_count == 0 ||
+            header.line_uv_count != static_cast<uint32_t>(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1))
+        {
+            return false;
+        }
+
+        ImVec4 line_uvs[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+        if (!reader.ReadBytes(line_uvs, sizeof(line_uvs)))
+        {
+            return false;
+        }
+
+        const auto rect_count = static_cast<int32_t>(header.custom_rect_count);
+        if (header.pack_id_mouse_cursors >= rect_count || header.pack_id_lines >= rect_count)
+        {
+            return false;
+        }
+        std::vector<CustomRectRecord> rects(header.custom_rect_count);
+        for (CustomRectRecord &rect : rects)
+        {
+            if (!reader.Read(rect) || rect.width == 0 || rect.height == 0)
+            {
+                return false;
+            }
+        }
+
+        atlas.Clear();
+        // Same indices as when the atlas was built
+        for (const CustomRectRecord &record : rects)
+        {
+            ImFontAtlasCustomRect *rect =
+                atlas.GetCustomRectByIndex(atlas.AddCustomRectRegular(record.width, record.height));
+            rect->X = record.x;
+            rect->Y = record.y;
+        }
+        atlas.PackIdMouseCursors = header.pack_id_mouse_cursors;
+        atlas.PackIdLines = header.pack_id_lines;
+
+        for (uint32_t font_index = 0; font_index < header.font_count; ++font_index)
+        {
+            FontRecord record{};
+            if (!reader.Read(record))
+            {
+                atlas.Clear();
+                return false;
+            }
+
+            ImFont *font = IM_NEW(ImFont);
+            font->ContainerAtlas = &atlas;
+            font->FontSize = record.size;
+            font->Ascent = record.ascent;
+            font->Descent = record.descent;
+            atlas.Fonts.push_back(font);
+
+            for (uint32_t i = 0; i < record.glyph_count; ++i)
+            {
+                GlyphRecord glyph{};
+                if (!reader.Read(glyph))
+                {
+                    atlas.Clear();
+                    return false;
+                }
+                // No config: the stored metrics already include offsets and min advance
+                font->AddGlyph(nullptr, static_cast<ImWchar>(glyph.codepoint), glyph.x0,
+                               glyph.y0, glyph.x1, glyph.y1, glyph.u0, glyph.v0, glyph.u1,
+                               glyph.v1, glyph.advance_x);
+            }
+            font->BuildLookupTable();
+        }
+
+        const size_t pixel_count = static_cast<size_t>(header.width) * header.height;
+        auto *pixels = static_cast<unsigned char *>(IM_ALLOC(pixel_count));
+        if (!reader.ReadBytes(pixels, pixel_count))
+        {
+            IM_FREE(pixels);
+            atlas.Clear();
+            return false;
+        }
+
+        // GetTexDataAsRGBA32 converts from these alpha pixels instead of rebuilding
+        atlas.TexPixelsAlpha8 = pixels;
+        atlas.TexWidth = header.width;
+        atlas.TexHeight = header.height;
+        atlas.TexUvScale = header.uv_scale;
+        atlas.TexUvWhitePixel = header.uv_white_pixel;
+        std::memcpy(atlas.TexUvLines, line_uvs, sizeof(line_uvs));
+        atlas.TexReady = true;
+        return true;
+    }
+
+    bool FontAtlasCache::Store(const ImFontAtlas &atlas) const
+    {
+        if (!IsEnabled() || !atlas.TexPixelsAlpha8 || atlas.Fonts.empty())
+        {
+            return false;
+        }
+
+        FileHeader header{};
+        header.magic = kMagic;
+        header.version = kVersion;
+        header.key = key_;
+        header.width = atlas.TexWidth;
+        header.height = atlas.TexHeight;
+        header.font_count = static_cast<uint32_t>(atlas.Fonts.Size);
+        header.line_uv_count = IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1;
+        header.uv_scale = atlas.TexUvScale;
+        header.uv_white_pixel = atlas.TexUvWhitePixel;
+        header.custom_rect_count = static_cast<uint32_t>(atlas.CustomRects.Size);
+        header.pack_id_mouse_cursors = atlas.PackIdMouseCursors;
+        header.pack_id_lines = atlas.PackIdLines;
+
+        const std::string temporary_path = path_ + ".tmp";
+        {
+            std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+            Write(file, header);
+            file.write(reinterpret_cast<const char *>(atlas.TexUvLines),
+                       sizeof(atlas.TexUvLines));
+            for (const ImFontAtlasCustomRect &rect : atlas.CustomRects)
+            {
+                Write(file, CustomRectRecord{rect.X, rect.Y, rect.Width, rect.Height});
+            }
+
+            for (const ImFont *font : atlas.Fonts)
+            {
+                Write(file, FontRecord{font->FontSize, font->Ascent, font->Descent,
+                                       static_cast<uint32_t>(font->Glyphs.Size)});
+                for (const ImFontGlyph &glyph : font->Glyphs)
+                {
+                    Write(file, GlyphRecord{glyph.Codepoint, glyph.AdvanceX, glyph.X0, glyph.Y0,
+                                            glyph.X1, glyph.Y1, glyph.U0, glyph.V0, glyph.U1,
+                                            glyph.V1});
+                }
+            }
+
+            file.write(reinterpret_cast<const char *>(atlas.TexPixelsAlpha8),
+                       static_cast<std::streamsize>(atlas.TexWidth) * atlas.TexHeight);
+            if (!file)
+            {
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary_path, path_, error);
+        return !error;
+    }
+
+#else
+
+    bool FontAtlasCache::Load(ImFontAtlas &atlas) const { return false; }
+    bool FontAtlasCache::Store(const ImFontAtlas &atlas) const { return false; }
+
+#endif
+
+} // namespace flux
@@ -0,0 +1,60 @@
+// Copyright 2026 Beisent
+// Baked ImGui font atlas cache for Flux framework
+
+#ifndef FLUX_CORE_SRC_FONTATLASCACHE_HPP_
+#define FLUX_CORE_SRC_FONTATLASCACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <imgui.h>
+
+namespace flux
+{
+
+    struct FontAtlasStats
+    {
+        double load_ms = 0.0;        // Adding + rasterizing fonts, or restoring the cache
+        bool from_cache = false;
+        bool dynamic_glyphs = false; // ImGui 1.92+: glyphs are rasterized on first use
+        int width = 0;
+        int height = 0;
+        size_t texture_bytes = 0;    // RGBA32 as uploaded by the renderer backend
+        int glyph_count = 0;
+    };
+
+    // Serializes a built atlas (alpha pixels, UV data, custom rects such as the
+    // software mouse cursor, and per-font glyph tables) to a single file and rebuilds the ImFont objects from it on the next launch, so
+    // large CJK ranges are not rasterized again. The key covers every input of the
+    // bake: font files (path, size, modification time), pixel sizes, glyph ranges,
+    // config flags and the ImGui version. Only supported before ImGui 1.92, whose
+    // dynamic fonts make it unnecessary.
+    class FontAtlasCache
+    {
+    public:
+        static constexpr uint32_t kMagic = 0x41465846; // "FXFA"
+        static constexpr uint32_t kVersion = 2;
+
+        explicit FontAtlasCache(std::string path);
+
+        [[nodiscard]] bool IsEnabled() const;
+
+        // Call once per font added to the atlas, in the same order
+        void AddSource(const std::string &font_path, const ImFontConfig &config,
+                       const ImWchar *glyph_ranges);
+
+        // Replaces the atlas contents, false when the file is missing or stale
+        bool Load(ImFontAtlas &atlas) const;
+        bool Store(const ImFontAtlas &atlas) const;
+
+    private:
+        void HashBytes(const void *data, size_t size);
+
+        std::string path_;
+        uint64_t key_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_FONTATLASCACHE_HPP_
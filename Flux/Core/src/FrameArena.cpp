@@ -0,0 +1,109 @@
+// Copyright 2026 Beisent
+// FrameArena implementation
+
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+namespace flux
+{
+
+    namespace
+    {
+        constexpr size_t kMinimumCapacity = 4096;
+    } // namespace
+
+    void *FrameArenaResource::do_allocate(size_t bytes, size_t alignment)
+    {
+        return arena_.Allocate(bytes, alignment);
+    }
+
+    FrameArena::FrameArena(size_t capacity) : resource_(*this)
+    {
+        AllocateBlock(std::max(capacity, kMinimumCapacity));
+    }
+
+    void FrameArena::AllocateBlock(size_t size)
+    {
+        // Not value-initialized, the arena hands out raw memory anyway
+        block_.reset(new std::byte[size]);
+        capacity_ = size;
+        cursor_ = block_.get();
+        end_ = cursor_ + size;
+    }
+
+    void *FrameArena::Allocate(size_t size, size_t alignment)
+    {
+        size = std::max<size_t>(size, 1);
+
+        auto try_bump = [&]() -> void *
+        {
+            const auto address = reinterpret_cast<uintptr_t>(cursor_);
+            const uintptr_t aligned = (address + alignment - 1) & ~(uintptr_t(alignment) - 1);
+            if (aligned + size > reinterpret_cast<uintptr_t>(end_))
+            {
+                return nullptr;
+            }
+            frame_bytes_ += (aligned - address) + size;
+            cursor_ = reinterpret_cast<std::byte *>(aligned + size);
+            return reinterpret_cast<void *>(aligned);
+        };
+
+        void *memory = try_bump();
+        if (!memory)
+        {
+            // Spill: the rest of the current block is wasted but counted, so the
+            // block allocated at Reset() covers this frame's whole footprint
+            frame_bytes_ += static_cast<size_t>(end_ - cursor_);
+            const size_t chunk_size = std::max(capacity_, size + alignment);
+            overflow_.emplace_back(new std::byte[chunk_size]);
+            ++overflow_count_;
+            cursor_ = overflow_.back().get();
+            end_ = cursor_ + chunk_size;
+            memory = try_bump();
+        }
+
+        used_bytes_ += size;
+        peak_bytes_ = std::max(peak_bytes_, frame_bytes_);
+        return memory;
+    }
+
+    const char *FrameArena::Format(const char *format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        va_list measure;
+        va_copy(measure, args);
+        const int length = std::vsnprintf(nullptr, 0, format, measure);
+        va_end(measure);
+
+        if (length < 0)
+        {
+            va_end(args);
+            return "";
+        }
+
+        auto *text = static_cast<char *>(Allocate(static_cast<size_t>(length) + 1, 1));
+        std::vsnprintf(text, static_cast<size_t>(length) + 1, format, args);
+        va_end(args);
+        return text;
+    }
+
+    void FrameArena::Reset()
+    {
+        if (!overflow_.empty())
+        {
+            overflow_.clear();
+            // Headroom so a slowly growing workload does not spill every frame
+            AllocateBlock(std::max(capacity_ * 2, frame_bytes_ + frame_bytes_ / 2));
+        }
+
+        cursor_ = block_.get();
+        end_ = cursor_ + capacity_;
+        used_bytes_ = 0;
+        frame_bytes_ = 0;
+    }
+
+} // namespace flux
@@ -0,0 +1,106 @@
+// Copyright 2026 Beisent
+// Per-frame linear allocator for Flux framework
+
+#ifndef FLUX_CORE_SRC_FRAMEARENA_HPP_
+#define FLUX_CORE_SRC_FRAMEARENA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace flux
+{
+
+    class FrameArena;
+
+    // std::pmr adapter: deallocation is a no-op, memory comes back on Reset()
+    class FrameArenaResource final : public std::pmr::memory_resource
+    {
+    public:
+        explicit FrameArenaResource(FrameArena &arena) : arena_(arena) {}
+
+    private:
+        void *do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void *, size_t, size_t) override {}
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        FrameArena &arena_;
+    };
+
+    // Bump allocator emptied once per frame. A frame that outgrows the block spills
+    // into extra heap chunks; the next Reset() replaces everything with one block
+    // large enough for that peak, so a steady workload stops touching the heap after
+    // its first few frames. Destructors are never run, and the arena is not thread
+    // safe.
+    class FrameArena
+    {
+    public:
+        explicit FrameArena(size_t capacity = 1024 * 1024);
+
+        FrameArena(const FrameArena &) = delete;
+        FrameArena &operator=(const FrameArena &) = delete;
+
+        [[nodiscard]] void *Allocate(size_t size,
+                                     size_t alignment = alignof(std::max_align_t));
+
+        template <typename T, typename... Args>
+        [[nodiscard]] T *New(Args &&...args)
+        {
+            static_assert(std::is_trivially_destructible_v<T>,
+                          "Frame arena objects are never destroyed");
+            return ::new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        [[nodiscard]] T *NewArray(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>,
+                          "Frame arena objects are never destroyed");
+            T *items = static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+            for (size_t i = 0; i < count; ++i)
+            {
+                ::new (items + i) T();
+            }
+            return items;
+        }
+
+        // printf into arena memory, e.g. for ImGui labels built every frame
+        [[nodiscard]] const char *Format(const char *format, ...);
+
+        // For std::pmr::vector, std::pmr::string and friends living within a frame
+        [[nodiscard]] std::pmr::memory_resource *GetResource() { return &resource_; }
+
+        void Reset();
+
+        [[nodiscard]] size_t GetCapacity() const { return capacity_; }
+        [[nodiscard]] size_t GetUsedBytes() const { return used_bytes_; }
+        [[nodiscard]] size_t GetPeakBytes() const { return peak_bytes_; }
+        // Heap chunks allocated because a frame did not fit, in total
+        [[nodiscard]] uint64_t GetOverflowCount() const { return overflow_count_; }
+
+    private:
+        void AllocateBlock(size_t size);
+
+        FrameArenaResource resource_;
+        std::unique_ptr<std::byte[]> block_;
+        std::vector<std::unique_ptr<std::byte[]>> overflow_;
+        std::byte *cursor_ = nullptr;
+        std::byte *end_ = nullptr;
+        size_t capacity_ = 0;
+        size_t used_bytes_ = 0;
+        size_t frame_bytes_ = 0; // Including alignment padding and spill, sizes the next block
+        size_t peak_bytes_ = 0;
+        uint64_t overflow_count_ = 0;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_FRAMEARENA_HPP_
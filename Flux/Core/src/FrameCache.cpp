@@ -0,0 +1,222 @@
+// Copyright 2026 Beisent
+// FrameCache implementation
+
+#include "FrameCache.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include <glad/glad.h>
+
+namespace flux
+{
+
+    namespace
+    {
+        constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+        constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr uint64_t kPrime3 = 0x165667B19E3779F9ull;
+
+        uint64_t Rotate(uint64_t value, int bits)
+        {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        uint64_t Round(uint64_t accumulator, uint64_t input)
+        {
+            return Rotate(accumulator + input * kPrime2, 31) * kPrime1;
+        }
+
+        // xxHash64-style, four independent lanes so large vertex buffers hash at
+        // memory speed. Only compared within one run, never stored.
+        uint64_t HashBytes(uint64_t seed, const void *data, size_t size)
+        {
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            const unsigned char *end = bytes + size;
+            uint64_t word = 0;
+
+            uint64_t hash = seed + kPrime3;
+            if (size >= 32)
+            {
+                uint64_t lanes[4] = {seed + kPrime1 + kPrime2, seed + kPrime2, seed,
+                                     seed - kPrime1};
+                for (; end - bytes >= 32; bytes += 32)
+                {
+                    for (int lane = 0; lane < 4; ++lane)
+                    {
+                        std::memcpy(&word, bytes + lane * 8, sizeof(word));
+                        lanes[lane] = Round(lanes[lane], word);
+                    }
+                }
+                hash = Rotate(lanes[0], 1) + Rotate(lanes[1], 7) + Rotate(lanes[2], 12) +
+                       Rotate(lanes[3], 18);
+            }
+            hash += size;
+
+            for (; end - bytes >= 8; bytes += 8)
+            {
+                std::memcpy(&word, bytes, sizeof(word));
+                hash = Rotate(hash ^ Round(0, word), 27) * kPrime1 + kPrime3;
+            }
+            for (; bytes < end; ++bytes)
+            {
+                hash = Rotate(hash ^ (*bytes * kPrime3), 11) * kPrime1;
+            }
+
+            hash ^= hash >> 33;
+            hash *= kPrime2;
+            hash ^= hash >> 29;
+            hash *= kPrime3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+    } // namespace
+
+    uint64_t HashDrawData(const ImDrawData &draw_data, uint64_t &hashed_bytes)
+    {
+#if IMGUI_VERSION_NUM >= 19200
+        // Atlas pages being created or updated are drawn by the backend first
+        if (draw_data.Textures)
+        {
+            for (const ImTextureData *texture : *draw_data.Textures)
+            {
+                if (texture->Status != ImTextureStatus_OK)
+                {
+                    return FrameCache::kUncacheable;
+                }
+            }
+        }
+#endif
+
+        const float display[6] = {draw_data.DisplayPos.x,       draw_data.DisplayPos.y,
+                                  draw_data.DisplaySize.x,      draw_data.DisplaySize.y,
+                                  draw_data.FramebufferScale.x, draw_data.FramebufferScale.y};
+        uint64_t hash = HashBytes(0, display, sizeof(display));
+
+        for (const ImDrawList *draw_list : draw_data.CmdLists)
+        {
+            // A callback may draw anything, only the backend knows
+            for (const ImDrawCmd &command : draw_list->CmdBuffer)
+            {
+                if (command.UserCallback)
+                {
+                    return FrameCache::kUncacheable;
+                }
+            }
+
+            const size_t vertex_bytes = draw_list->VtxBuffer.Size * sizeof(ImDrawVert);
+            const size_t index_bytes = draw_list->IdxBuffer.Size * sizeof(ImDrawIdx);
+            hash = HashBytes(hash, draw_list->VtxBuffer.Data, vertex_bytes);
+            hash = HashBytes(hash, draw_list->IdxBuffer.Data, index_bytes);
+            hashed_bytes += vertex_bytes + index_bytes;
+
+            for (const ImDrawCmd &command : draw_list->CmdBuffer)
+            {
+                uint64_t key[5];
+                std::memcpy(key, &command.ClipRect, sizeof(command.ClipRect));
+                key[2] = static_cast<uint64_t>((intptr_t)command.GetTexID());
+                key[3] = (static_cast<uint64_t>(command.VtxOffset) << 32) | command.IdxOffset;
+                key[4] = command.ElemCount;
+                hash = HashBytes(hash, key, sizeof(key));
+            }
+        }
+        return hash == FrameCache::kUncacheable ? 1 : hash;
+    }
+
+    uint64_t FrameCache::Hash(const ImDrawData &draw_data)
+    {
+        stats_.hashed_bytes = 0;
+        return HashDrawData(draw_data, stats_.hashed_bytes);
+    }
+
+    bool FrameCache::Present(uint64_t hash, uint32_t width, uint32_t height)
+    {
+        if (!valid_ || hash == kUncacheable || hash != hash_ || attachments_.width != width ||
+            attachments_.height != height)
+        {
+            return false;
+        }
+
+        GLint framebuffer = 0;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, attachments_.framebuffer);
+        const GLint w = static_cast<GLint>(width);
+        const GLint h = static_cast<GLint>(height);
+        glBlitFramebuffer(0, 0, w, h, 0, 0, w, h, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(framebuffer));
+
+        ++stats_.reused_frames;
+        stats_.last_reused = true;
+        return true;
+    }
+
+    void FrameCache::Store(uint64_t hash, uint32_t width, uint32_t height)
+    {
+        ++stats_.rendered_frames;
+        stats_.last_reused = false;
+
+        // Copied only once the same frame is rendered twice in a row, a UI that
+        // changes every frame never pays for the copy
+        const bool repeated = hash != kUncacheable && hash == previous_hash_;
+        previous_hash_ = hash;
+        if (!repeated || (valid_ && hash == hash_) || width == 0 || height == 0 ||
+            !IsBlitTarget())
+        {
+            return;
+        }
+
+        valid_ = false;
+        if (attachments_.width != width || attachments_.height != height)
+        {
+            pool_.Release(std::exchange(attachments_, RenderTargetAttachments()));
+            attachments_ = pool_.Acquire(width, height, 0, false);
+        }
+        if (!attachments_.IsValid())
+        {
+            return;
+        }
+
+        GLint framebuffer = 0;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(framebuffer));
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, attachments_.framebuffer);
+        const GLint w = static_cast<GLint>(width);
+        const GLint h = static_cast<GLint>(height);
+        glBlitFramebuffer(0, 0, w, h, 0, 0, w, h, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(framebuffer));
+
+        hash_ = hash;
+        valid_ = true;
+    }
+
+    void FrameCache::Invalidate()
+    {
+        valid_ = false;
+        previous_hash_ = kUncacheable;
+    }
+
+    void FrameCache::Shutdown()
+    {
+        pool_.Release(std::exchange(attachments_, RenderTargetAttachments()));
+        valid_ = false;
+    }
+
+    bool FrameCache::IsBlitTarget()
+    {
+        GLint sample_buffers = 0;
+        glGetIntegerv(GL_SAMPLE_BUFFERS, &sample_buffers);
+        if (sample_buffers > 0)
+        {
+            if (!multisampled_warned_)
+            {
+                std::fprintf(stderr, "[Flux] Frame reuse needs a single-sample window, "
+                                     "disabled with msaa_samples\n");
+                multisampled_warned_ = true;
+            }
+            return false;
+        }
+        return true;
+    }
+
+} // namespace flux
@@ -0,0 +1,75 @@
+// Copyright 2026 Beisent
+// Reuse of unchanged frames for Flux framework
+
+#ifndef FLUX_CORE_SRC_FRAMECACHE_HPP_
+#define FLUX_CORE_SRC_FRAMECACHE_HPP_
+
+#include <cstdint>
+
+#include <imgui.h>
+
+#include "RenderTarget.hpp"
+
+namespace flux
+{
+
+    struct FrameCacheStats
+    {
+        uint64_t reused_frames = 0;
+        uint64_t rendered_frames = 0;
+        uint64_t hashed_bytes = 0; // Draw data hashed by the last frame
+        bool last_reused = false;
+    };
+
+    // Keeps a copy of the last frame ImGui rendered into the window together with a
+    // hash of its draw data. When the next frame's draw data hashes the same and
+    // nothing else drew into the window, Present() copies the stored frame back
+    // instead of uploading and drawing the lists again. Single-sample framebuffers
+    // only: a multisampled one cannot be the target of a blit. GL thread only.
+    class FrameCache
+    {
+    public:
+        explicit FrameCache(RenderTargetPool &pool) : pool_(pool) {}
+        ~FrameCache() = default;
+
+        FrameCache(const FrameCache &) = delete;
+        FrameCache &operator=(const FrameCache &) = delete;
+
+        // Vertices, indices, commands and display size of every list. Lists with
+        // user callbacks, and with ImGui 1.92 textures waiting for the backend,
+        // return kUncacheable.
+        [[nodiscard]] uint64_t Hash(const ImDrawData &draw_data);
+
+        // Copies the stored frame into the bound framebuffer when it has this hash
+        [[nodiscard]] bool Present(uint64_t hash, uint32_t width, uint32_t height);
+        // After rendering into the bound framebuffer; keeps a copy once the same
+        // hash was rendered twice in a row
+        void Store(uint64_t hash, uint32_t width, uint32_t height);
+        // Something outside ImGui drew into the window this frame: neither it nor
+        // the stored frame may be presented again
+        void Invalidate();
+        void Shutdown();
+
+        [[nodiscard]] const FrameCacheStats &GetStats() const { return stats_; }
+
+        static constexpr uint64_t kUncacheable = 0;
+
+    private:
+        [[nodiscard]] bool IsBlitTarget();
+
+        RenderTargetPool &pool_;
+        RenderTargetAttachments attachments_;
+        uint64_t hash_ = kUncacheable;          // Of the stored frame
+        uint64_t previous_hash_ = kUncacheable; // Of the last rendered frame
+        bool valid_ = false;
+        bool multisampled_warned_ = false;
+        FrameCacheStats stats_;
+    };
+
+    // What FrameCache::Hash() computes, for other draw data than the main
+    // viewport's; adds the bytes hashed to hashed_bytes
+    [[nodiscard]] uint64_t HashDrawData(const ImDrawData &draw_data, uint64_t &hashed_bytes);
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_FRAMECACHE_HPP_
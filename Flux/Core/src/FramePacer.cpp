@@ -0,0 +1,138 @@
+// Copyright 2026 Beisent
+// FramePacer implementation
+
+#include "FramePacer.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include <glad/glad.h>
+
+namespace flux
+{
+
+    namespace
+    {
+        float ToMilliseconds(std::chrono::steady_clock::duration duration)
+        {
+            return std::chrono::duration<float, std::milli>(duration).count();
+        }
+    } // namespace
+
+    FramePacer::~FramePacer() { Shutdown(); }
+
+    void FramePacer::Configure(float target_fps, uint32_t max_frames_in_flight)
+    {
+        frame_interval_ = target_fps > 0.0f
+                              ? std::chrono::duration_cast<Clock::duration>(
+                                    std::chrono::duration<double>(1.0 / target_fps))
+                              : Clock::duration::zero();
+        max_frames_in_flight_ = max_frames_in_flight;
+        next_frame_ = Clock::now();
+        last_frame_start_ = next_frame_;
+        last_input_sample_ = next_frame_;
+    }
+
+    void FramePacer::Shutdown()
+    {
+        for (void *fence : fences_)
+        {
+            glDeleteSync(static_cast<GLsync>(fence));
+        }
+        fences_.clear();
+    }
+
+    void FramePacer::WaitForNextFrame()
+    {
+        const Clock::time_point wait_start = Clock::now();
+        if (frame_interval_ > Clock::duration::zero())
+        {
+            WaitUntil(next_frame_);
+        }
+        const Clock::time_point cap_done = Clock::now();
+        stats_.cap_wait_ms = ToMilliseconds(cap_done - wait_start);
+
+        ThrottleFramesInFlight();
+        stats_.fence_wait_ms = ToMilliseconds(Clock::now() - cap_done);
+
+        const Clock::time_point frame_start = Clock::now();
+        stats_.frame_interval_ms = ToMilliseconds(frame_start - last_frame_start_);
+        last_frame_start_ = frame_start;
+
+        // Never schedule in the past, a long frame must not cause a burst of short ones
+        next_frame_ = std::max(next_frame_ + frame_interval_, frame_start);
+    }
+
+    void FramePacer::OnInputSampled() { last_input_sample_ = Clock::now(); }
+
+    void FramePacer::OnFramePresented()
+    {
+        stats_.input_to_present_ms = ToMilliseconds(Clock::now() - last_input_sample_);
+
+        if (max_frames_in_flight_ > 0)
+        {
+            fences_.push_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        }
+        stats_.frames_in_flight = static_cast<uint32_t>(fences_.size());
+    }
+
+    void FramePacer::WaitUntil(Clock::time_point deadline)
+    {
+        // Sleep while the remaining time comfortably exceeds the observed sleep
+        // overshoot, then spin for the last stretch
+        for (;;)
+        {
+            const Clock::time_point now = Clock::now();
+            const Clock::duration remaining = deadline - now;
+            if (remaining <= sleep_overshoot_)
+            {
+                break;
+            }
+
+            const Clock::duration request =
+                std::min<Clock::duration>(remaining - sleep_overshoot_,
+                                          std::chrono::milliseconds(1));
+            std::this_thread::sleep_for(request);
+
+            const Clock::duration overshoot = (Clock::now() - now) - request;
+            sleep_overshoot_ += (overshoot - sleep_overshoot_) / 8;
+            sleep_overshoot_ = std::clamp<Clock::duration>(
+                sleep_overshoot_, std::chrono::microseconds(50), std::chrono::milliseconds(4));
+        }
+        stats_.sleep_overshoot_ms = ToMilliseconds(sleep_overshoot_);
+
+        while (Clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void FramePacer::ThrottleFramesInFlight()
+    {
+        if (max_frames_in_flight_ == 0)
+        {
+            return;
+        }
+
+        while (fences_.size() >= max_frames_in_flight_)
+        {
+            GLsync fence = static_cast<GLsync>(fences_.front());
+            fences_.pop_front();
+            glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+            glDeleteSync(fence);
+        }
+
+        // Drop fences the GPU already passed so the count reflects real queue depth
+        while (!fences_.empty())
+        {
+            GLsync fence = static_cast<GLsync>(fences_.front());
+            if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+            {
+                break;
+            }
+            fences_.pop_front();
+            glDeleteSync(fence);
+        }
+    }
+
+} // namespace flux
@@ -0,0 +1,68 @@
+// Copyright 2026 Beisent
+// Frame pacing and latency control for Flux framework
+
+#ifndef FLUX_CORE_SRC_FRAMEPACER_HPP_
+#define FLUX_CORE_SRC_FRAMEPACER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+
+namespace flux
+{
+
+    struct FramePacerStats
+    {
+        float cap_wait_ms = 0.0f;        // Time spent waiting for the FPS cap
+        float fence_wait_ms = 0.0f;      // Time blocked on frames-in-flight fences
+        float frame_interval_ms = 0.0f;  // Start-to-start interval of the last frame
+        float input_to_present_ms = 0.0f; // Last event poll to end of swap (CPU side)
+        float sleep_overshoot_ms = 0.0f; // Current estimate of OS sleep inaccuracy
+        uint32_t frames_in_flight = 0;
+        bool adaptive_vsync_active = false;
+    };
+
+    // Caps the frame rate with a hybrid sleep/spin waiter and limits how many
+    // frames the GPU may queue using fence syncs. Must run on the GL thread.
+    class FramePacer
+    {
+    public:
+        FramePacer() = default;
+        ~FramePacer();
+
+        FramePacer(const FramePacer &) = delete;
+        FramePacer &operator=(const FramePacer &) = delete;
+
+        // target_fps <= 0 disables the cap, max_frames_in_flight == 0 disables fences
+        void Configure(float target_fps, uint32_t max_frames_in_flight);
+        void Shutdown();
+
+        // Blocks until the next frame may start
+        void WaitForNextFrame();
+        void OnInputSampled();
+        void OnFramePresented();
+
+        void SetAdaptiveVsyncActive(bool active) { stats_.adaptive_vsync_active = active; }
+        [[nodiscard]] const FramePacerStats &GetStats() const { return stats_; }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        void WaitUntil(Clock::time_point deadline);
+        void ThrottleFramesInFlight();
+
+        Clock::duration frame_interval_{};
+        Clock::time_point next_frame_{};
+        Clock::time_point last_frame_start_{};
+        Clock::time_point last_input_sample_{};
+        Clock::duration sleep_overshoot_ = std::chrono::microseconds(500);
+
+        uint32_t max_frames_in_flight_ = 0;
+        std::deque<void *> fences_;
+
+        FramePacerStats stats_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_FRAMEPACER_HPP_
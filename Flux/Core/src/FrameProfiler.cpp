@@ -0,0 +1,165 @@
+// Copyright 2026 Beisent
+// FrameProfiler implementation
+
+#include "FrameProfiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace flux
+{
+
+    FrameProfiler::FrameProfiler()
+    {
+        scope_names_.reserve(kReservedScopes);
+        current_.scope_ms.reserve(kReservedScopes);
+        for (FrameRecord &record : history_)
+        {
+            record.scope_ms.reserve(kReservedScopes);
+        }
+        scratch_.reserve(kHistorySize);
+    }
+
+    ProfileScopeId FrameProfiler::RegisterScope(std::string_view name)
+    {
+        for (size_t i = 0; i < scope_names_.size(); ++i)
+        {
+            if (scope_names_[i] == name)
+            {
+                return static_cast<ProfileScopeId>(i);
+            }
+        }
+
+        if (scope_names_.size() >= kMaxScopes)
+        {
+            if (!full_warned_)
+            {
+                std::fprintf(stderr, "[Flux] More than %zu profile scopes, %.*s is not profiled\n",
+                             kMaxScopes, static_cast<int>(name.size()), name.data());
+                full_warned_ = true;
+            }
+            return kInvalidProfileScope;
+        }
+
+        scope_names_.emplace_back(name);
+        trace_names_.push_back(Tracer::Get().Intern(name));
+
+        // Older frames read 0 for the new scope, EndFrame() copies without allocating
+        const size_t scope_count = scope_names_.size();
+        current_.scope_ms.resize(scope_count, 0.0f);
+        for (FrameRecord &record : history_)
+        {
+            record.scope_ms.resize(scope_count, 0.0f);
+        }
+        return static_cast<ProfileScopeId>(scope_names_.size() - 1);
+    }
+
+    std::string_view FrameProfiler::GetScopeName(ProfileScopeId id) const
+    {
+        if (id >= scope_names_.size())
+        {
+            return {};
+        }
+        return scope_names_[id];
+    }
+
+    void FrameProfiler::BeginFrame()
+    {
+        std::fill(current_.scope_ms.begin(), current_.scope_ms.end(), 0.0f);
+        frame_start_ = Clock::now();
+    }
+
+    void FrameProfiler::EndFrame()
+    {
+        if (!enabled_)
+        {
+            return;
+        }
+
+        const uint64_t index = write_index_.load(std::memory_order_relaxed);
+        current_.frame_index = index;
+        current_.total_ms =
+            std::chrono::duration<float, std::milli>(Clock::now() - frame_start_).count();
+
+        history_[index % kHistorySize] = current_;
+        write_index_.store(index + 1, std::memory_order_release);
+    }
+
+    size_t FrameProfiler::GetFrameHistoryCount() const
+    {
+        const uint64_t written = write_index_.load(std::memory_order_acquire);
+        return static_cast<size_t>(std::min<uint64_t>(written, kHistorySize - 1));
+    }
+
+    bool FrameProfiler::CopyFrame(size_t frames_ago, FrameRecord &out) const
+    {
+        const uint64_t written = write_index_.load(std::memory_order_acquire);
+        if (frames_ago >= written || frames_ago >= kHistorySize - 1)
+        {
+            return false;
+        }
+
+        const uint64_t index = written - 1 - frames_ago;
+        out = history_[index % kHistorySize];
+
+        // The writer may have lapped us while copying
+        const uint64_t written_after = write_index_.load(std::memory_order_acquire);
+        return written_after - index < kHistorySize && out.frame_index == index;
+    }
+
+    ProfileScopeStats FrameProfiler::ComputeScopeStats(ProfileScopeId id,
+                                                       size_t frame_count) const
+    {
+        if (id >= scope_names_.size())
+        {
+            return {};
+        }
+        return ComputeStats(frame_count, id);
+    }
+
+    ProfileScopeStats FrameProfiler::ComputeFrameStats(size_t frame_count) const
+    {
+        return ComputeStats(frame_count, kInvalidProfileScope);
+    }
+
+    ProfileScopeStats FrameProfiler::ComputeStats(size_t frame_count, ProfileScopeId id) const
+    {
+        ProfileScopeStats stats;
+        frame_count = std::min(frame_count, GetFrameHistoryCount());
+        if (frame_count == 0)
+        {
+            return stats;
+        }
+
+        const uint64_t written = write_index_.load(std::memory_order_acquire);
+        scratch_.clear();
+        for (size_t i = 0; i < frame_count; ++i)
+        {
+            const FrameRecord &record = history_[(written - 1 - i) % kHistorySize];
+            scratch_.push_back(id == kInvalidProfileScope ? record.total_ms
+                                                          : record.scope_ms[id]);
+        }
+
+        stats.last_ms = scratch_.front();
+        float sum = 0.0f;
+        for (float value : scratch_)
+        {
+            sum += value;
+        }
+        stats.average_ms = sum / static_cast<float>(scratch_.size());
+
+        auto percentile = [this](float p)
+        {
+            const size_t rank = static_cast<size_t>(p * static_cast<float>(scratch_.size() - 1));
+            std::nth_element(scratch_.begin(), scratch_.begin() + rank, scratch_.end());
+            return scratch_[rank];
+        };
+
+        stats.p50_ms = percentile(0.50f);
+        stats.p95_ms = percentile(0.95f);
+        stats.p99_ms = percentile(0.99f);
+        stats.max_ms = *std::max_element(scratch_.begin(), scratch_.end());
+        return stats;
+    }
+
+} // namespace flux
@@ -0,0 +1,148 @@
+// Copyright 2026 Beisent
+// Per-frame CPU profiler for Flux framework
+
+#ifndef FLUX_CORE_SRC_FRAMEPROFILER_HPP_
+#define FLUX_CORE_SRC_FRAMEPROFILER_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Trace.hpp"
+
+namespace flux
+{
+
+    using ProfileScopeId = uint16_t;
+    inline constexpr ProfileScopeId kInvalidProfileScope = 0xFFFF;
+
+    struct ProfileScopeStats
+    {
+        float last_ms = 0.0f;
+        float average_ms = 0.0f;
+        float p50_ms = 0.0f;
+        float p95_ms = 0.0f;
+        float p99_ms = 0.0f;
+        float max_ms = 0.0f;
+    };
+
+    // The per-scope tables grow with RegisterScope(), which therefore must not run
+    // while a scope is being written or the history read from another thread. The
+    // application registers between frames, under the update lock.
+    class FrameProfiler
+    {
+    public:
+        // Ids are 16 bits; tables for kReservedScopes are allocated up front
+        static constexpr size_t kMaxScopes = kInvalidProfileScope;
+        static constexpr size_t kReservedScopes = 128;
+        static constexpr size_t kHistorySize = 256;
+
+        struct FrameRecord
+        {
+            uint64_t frame_index = 0;
+            float total_ms = 0.0f;
+            std::vector<float> scope_ms; // One entry per registered scope
+        };
+
+        FrameProfiler();
+
+        // Scopes are registered once and referenced by id on the hot path.
+        // Registering an existing name returns its id.
+        ProfileScopeId RegisterScope(std::string_view name);
+        [[nodiscard]] std::string_view GetScopeName(ProfileScopeId id) const;
+        [[nodiscard]] size_t GetScopeCount() const { return scope_names_.size(); }
+        // Interned copy of the name for trace events, nullptr for invalid ids
+        [[nodiscard]] const char *GetTraceName(ProfileScopeId id) const
+        {
+            return id < trace_names_.size() ? trace_names_[id] : nullptr;
+        }
+
+        void BeginFrame();
+        void EndFrame();
+
+        // Accumulates into the current frame. Different scopes may be written from
+        // different threads as long as each scope has a single writer per frame.
+        void AddSample(ProfileScopeId id, float milliseconds)
+        {
+            if (enabled_ && id < current_.scope_ms.size())
+            {
+                current_.scope_ms[id] += milliseconds;
+            }
+        }
+
+        // Ring buffer of completed frames. The writer publishes with a release store,
+        // readers copy a slot and validate that it was not overwritten meanwhile.
+        // Reuse out across calls, its scope_ms is allocated on the first copy.
+        [[nodiscard]] size_t GetFrameHistoryCount() const;
+        bool CopyFrame(size_t frames_ago, FrameRecord &out) const;
+
+        [[nodiscard]] ProfileScopeStats ComputeScopeStats(ProfileScopeId id,
+                                                          size_t frame_count) const;
+        [[nodiscard]] ProfileScopeStats ComputeFrameStats(size_t frame_count) const;
+
+        void SetEnabled(bool enabled) { enabled_ = enabled; }
+        [[nodiscard]] bool IsEnabled() const { return enabled_; }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        ProfileScopeStats ComputeStats(size_t frame_count, ProfileScopeId id) const;
+
+        bool enabled_ = true;
+        bool full_warned_ = false;
+        std::vector<std::string> scope_names_;
+        std::vector<const char *> trace_names_;
+
+        FrameRecord current_;
+        Clock::time_point frame_start_;
+
+        std::array<FrameRecord, kHistorySize> history_;
+        std::atomic<uint64_t> write_index_{0};
+
+        mutable std::vector<float> scratch_;
+    };
+
+    // Also emits a trace span when built with FLUX_ENABLE_TRACING, so every profiled
+    // phase shows up on the timeline
+    class ProfileScope
+    {
+    public:
+        ProfileScope(FrameProfiler &profiler, ProfileScopeId id)
+            : profiler_(profiler), id_(id), start_(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~ProfileScope()
+        {
+            const auto end = std::chrono::steady_clock::now();
+            profiler_.AddSample(
+                id_, std::chrono::duration<float, std::milli>(end - start_).count());
+#if defined(FLUX_ENABLE_TRACING)
+            if (const char *name = profiler_.GetTraceName(id_))
+            {
+                using std::chrono::nanoseconds;
+                Tracer::Get().Record(
+                    name,
+                    std::chrono::duration_cast<nanoseconds>(start_.time_since_epoch()).count(),
+                    std::chrono::duration_cast<nanoseconds>(end.time_since_epoch()).count());
+            }
+#endif
+        }
+
+        ProfileScope(const ProfileScope &) = delete;
+        ProfileScope &operator=(const ProfileScope &) = delete;
+
+    private:
+        FrameProfiler &profiler_;
+        ProfileScopeId id_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_FRAMEPROFILER_HPP_
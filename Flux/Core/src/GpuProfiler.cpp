@@ -0,0 +1,196 @@
+// Copyright 2026 Beisent
+// GpuProfiler implementation
+
+#include "GpuProfiler.hpp"
+
+#include <cstring>
+
+#include <glad/glad.h>
+
+namespace flux
+{
+
+    namespace
+    {
+        bool IsSoftwareRenderer()
+        {
+            const char *renderer = reinterpret_cast<const char *>(glGetString(GL_RENDERER));
+            if (!renderer)
+            {
+                return true;
+            }
+
+            const char *software_renderers[] = {"llvmpipe", "softpipe", "SwiftShader",
+                                                "Software Rasterizer", "OSMesa"};
+            for (const char *name : software_renderers)
+            {
+                if (std::strstr(renderer, name))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    } // namespace
+
+    GpuProfiler::~GpuProfiler() { Shutdown(); }
+
+    void GpuProfiler::Init()
+    {
+        GLint counter_bits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counter_bits);
+        supported_ = counter_bits > 0 && !IsSoftwareRenderer();
+        if (!supported_)
+        {
+            return;
+        }
+
+        for (FrameQueries &frame : frames_)
+        {
+            frame.queries.resize(kMaxScopesPerFrame * 2);
+            frame.scopes.resize(kMaxScopesPerFrame);
+            glGenQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+        }
+    }
+
+    void GpuProfiler::Shutdown()
+    {
+        if (!supported_)
+        {
+            return;
+        }
+
+        for (FrameQueries &frame : frames_)
+        {
+            glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+            frame.queries.clear();
+            frame.scopes.clear();
+            frame.used = 0;
+            frame.pending = false;
+        }
+        supported_ = false;
+    }
+
+    void GpuProfiler::BeginFrame()
+    {
+        recording_ = false;
+        if (!supported_)
+        {
+            return;
+        }
+
+        FrameQueries &frame = frames_[frame_index_ % kFramesInFlight];
+        if (frame.pending && !ResolveFrame(frame))
+        {
+            // The GPU is more than kFramesInFlight behind, skip instead of stalling
+            ++dropped_frames_;
+            return;
+        }
+
+        frame.used = 0;
+        frame.last_query = 0;
+        recording_ = true;
+    }
+
+    void GpuProfiler::EndFrame()
+    {
+        if (recording_)
+        {
+            FrameQueries &frame = frames_[frame_index_ % kFramesInFlight];
+            frame.pending = frame.used > 0;
+        }
+        recording_ = false;
+        ++frame_index_;
+    }
+
+    uint32_t GpuProfiler::BeginScope(ProfileScopeId id)
+    {
+        FrameQueries &frame = frames_[frame_index_ % kFramesInFlight];
+        if (!recording_ || id >= FrameProfiler::kMaxScopes ||
+            frame.used >= kMaxScopesPerFrame)
+        {
+            return kInvalidSlot;
+        }
+
+        const uint32_t slot = frame.used++;
+        frame.scopes[slot] = id;
+        glQueryCounter(frame.queries[slot * 2], GL_TIMESTAMP);
+        frame.last_query = slot * 2;
+        return slot;
+    }
+
+    void GpuProfiler::EndScope(uint32_t slot)
+    {
+        if (slot == kInvalidSlot || !recording_)
+        {
+            return;
+        }
+
+        FrameQueries &frame = frames_[frame_index_ % kFramesInFlight];
+        glQueryCounter(frame.queries[slot * 2 + 1], GL_TIMESTAMP);
+        frame.last_query = slot * 2 + 1;
+    }
+
+    bool GpuProfiler::ResolveFrame(FrameQueries &frame)
+    {
+        // Timestamps are written in submission order, so the one issued last gates
+        // every other query of the frame
+        GLint available = 0;
+        glGetQueryObjectiv(frame.queries[frame.last_query], GL_QUERY_RESULT_AVAILABLE,
+                           &available);
+        if (!available)
+        {
+            return false;
+        }
+
+        for (uint32_t slot = 0; slot < frame.used; ++slot)
+        {
+            const ProfileScopeId id = frame.scopes[slot];
+            if (id >= frame_ms_.size())
+            {
+                last_ms_.resize(id + 1, 0.0f);
+                average_ms_.resize(id + 1, 0.0f);
+                frame_ms_.resize(id + 1, 0.0f);
+            }
+            frame_ms_[id] = 0.0f;
+        }
+
+        for (uint32_t slot = 0; slot < frame.used; ++slot)
+        {
+            GLuint64 begin = 0;
+            GLuint64 end = 0;
+            glGetQueryObjectui64v(frame.queries[slot * 2], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(frame.queries[slot * 2 + 1], GL_QUERY_RESULT, &end);
+
+            const ProfileScopeId id = frame.scopes[slot];
+            frame_ms_[id] += end > begin ? static_cast<float>(end - begin) * 1e-6f : 0.0f;
+        }
+
+        // A scope measured several times is applied once, then marked done
+        for (uint32_t slot = 0; slot < frame.used; ++slot)
+        {
+            const ProfileScopeId id = frame.scopes[slot];
+            if (frame_ms_[id] < 0.0f)
+            {
+                continue;
+            }
+            last_ms_[id] = frame_ms_[id];
+            average_ms_[id] += (frame_ms_[id] - average_ms_[id]) * 0.1f;
+            frame_ms_[id] = -1.0f;
+        }
+
+        frame.pending = false;
+        return true;
+    }
+
+    float GpuProfiler::GetLastMilliseconds(ProfileScopeId id) const
+    {
+        return id < last_ms_.size() ? last_ms_[id] : 0.0f;
+    }
+
+    float GpuProfiler::GetAverageMilliseconds(ProfileScopeId id) const
+    {
+        return id < average_ms_.size() ? average_ms_[id] : 0.0f;
+    }
+
+} // namespace flux
@@ -0,0 +1,102 @@
+// Copyright 2026 Beisent
+// GPU timer queries for Flux render phases
+
+#ifndef FLUX_CORE_SRC_GPUPROFILER_HPP_
+#define FLUX_CORE_SRC_GPUPROFILER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FrameProfiler.hpp"
+
+namespace flux
+{
+
+    // Collects GPU time per profiler scope with timestamp queries. Results are read
+    // kFramesInFlight frames later and only when available, so the CPU never waits
+    // on the GPU. All calls must happen on the thread owning the GL context.
+    class GpuProfiler
+    {
+    public:
+        static constexpr size_t kFramesInFlight = 4;
+        static constexpr uint32_t kMaxScopesPerFrame = 256;
+        static constexpr uint32_t kInvalidSlot = 0xFFFFFFFF;
+
+        GpuProfiler() = default;
+        ~GpuProfiler();
+
+        GpuProfiler(const GpuProfiler &) = delete;
+        GpuProfiler &operator=(const GpuProfiler &) = delete;
+
+        // Falls back to no-ops on software rasterizers or without timer support
+        void Init();
+        void Shutdown();
+
+        void BeginFrame();
+        void EndFrame();
+
+        uint32_t BeginScope(ProfileScopeId id);
+        void EndScope(uint32_t slot);
+
+        [[nodiscard]] bool IsSupported() const { return supported_; }
+        [[nodiscard]] float GetLastMilliseconds(ProfileScopeId id) const;
+        [[nodiscard]] float GetAverageMilliseconds(ProfileScopeId id) const;
+        [[nodiscard]] uint64_t GetDroppedFrameCount() const { return dropped_frames_; }
+
+    private:
+        struct FrameQueries
+        {
+            std::vector<uint32_t> queries;
+            std::vector<ProfileScopeId> scopes;
+            uint32_t used = 0;
+            // Index into queries of the timestamp issued last. Scopes nest, so an
+            // outer end can follow the last slot's end.
+            uint32_t last_query = 0;
+            bool pending = false;
+        };
+
+        bool ResolveFrame(FrameQueries &frame);
+
+        bool supported_ = false;
+        bool recording_ = false;
+        size_t frame_index_ = 0;
+        uint64_t dropped_frames_ = 0;
+
+        std::array<FrameQueries, kFramesInFlight> frames_;
+        // Indexed by scope id, grown when a new id is first resolved
+        std::vector<float> last_ms_;
+        std::vector<float> average_ms_;
+        std::vector<float> frame_ms_;
+    };
+
+    class GpuProfileScope
+    {
+    public:
+        // A null profiler makes the scope a no-op, e.g. on threads without a GL context
+        GpuProfileScope(GpuProfiler *profiler, ProfileScopeId id)
+            : profiler_(profiler),
+              slot_(profiler ? profiler->BeginScope(id) : GpuProfiler::kInvalidSlot)
+        {
+        }
+
+        ~GpuProfileScope()
+        {
+            if (profiler_)
+            {
+                profiler_->EndScope(slot_);
+            }
+        }
+
+        GpuProfileScope(const GpuProfileScope &) = delete;
+        GpuProfileScope &operator=(const GpuProfileScope &) = delete;
+
+    private:
+        GpuProfiler *profiler_;
+        uint32_t slot_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_GPUPROFILER_HPP_
@@ -0,0 +1,559 @@
+// Copyright 2026 Beisent
+// ImGuiRenderer implementation
+
+#include "ImGuiRenderer.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#include <backends/imgui_impl_opengl3.h>
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace flux
+{
+
+    namespace
+    {
+        // Per command, read through a divisor-1 attribute at baseInstance
+        struct DrawInstance
+        {
+            ImVec4 clip_rect;
+            uint32_t slot;
+        };
+
+        // Layout fixed by glMultiDrawElementsIndirect
+        struct DrawElementsIndirectCommand
+        {
+            uint32_t count;
+            uint32_t instance_count;
+            uint32_t first_index;
+            int32_t base_vertex;
+            uint32_t base_instance;
+        };
+
+        static_assert(sizeof(DrawInstance) == 20, "DrawInstance is read as vec4 + uint");
+        static_assert(sizeof(DrawElementsIndirectCommand) == 20, "Indirect commands are packed");
+
+        constexpr size_t kInitialSegmentBytes = 1024 * 1024;
+        constexpr size_t kRegionAlignment = 16;
+        constexpr uint32_t kNoTexture = 0xFFFFFFFFu;
+        constexpr GLenum kIndexType = sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+
+        // Clip distances cut triangles at the clip rect exactly where the stock
+        // backend rounds its scissor box to whole pixels
+        constexpr const char *kVertexShader = R"(#version 430 core
+layout(location = 0) in vec2 a_position;
+layout(location = 1) in vec2 a_uv;
+layout(location = 2) in vec4 a_color;
+layout(location = 3) in vec4 a_clip_rect;
+layout(location = 4) in uint a_slot;
+
+uniform mat4 u_projection;
+
+out vec2 v_uv;
+out vec4 v_color;
+flat out uint v_slot;
+
+void main()
+{
+    v_uv = a_uv;
+    v_color = a_color;
+    v_slot = a_slot;
+    gl_ClipDistance[0] = a_position.x - a_clip_rect.x;
+    gl_ClipDistance[1] = a_clip_rect.z - a_position.x;
+    gl_ClipDistance[2] = a_position.y - a_clip_rect.y;
+    gl_ClipDistance[3] = a_clip_rect.w - a_position.y;
+    gl_Position = u_projection * vec4(a_position, 0.0, 1.0);
+}
+)";
+
+        constexpr const char *kFragmentShader = R"(#version 430 core
+in vec2 v_uv;
+in vec4 v_color;
+flat in uint v_slot;
+
+uniform sampler2D u_textures[16];
+
+out vec4 o_color;
+
+// Constant indices only: a per-draw index into a sampler array is not
+// dynamically uniform, which GLSL leaves undefined
+vec4 SampleSlot(uint slot, vec2 uv)
+{
+    switch (slot)
+    {
+    case 0u: return texture(u_textures[0], uv);
+    case 1u: return texture(u_textures[1], uv);
+    case 2u: return texture(u_textures[2], uv);
+    case 3u: return texture(u_textures[3], uv);
+    case 4u: return texture(u_textures[4], uv);
+    case 5u: return texture(u_textures[5], uv);
+    case 6u: return texture(u_textures[6], uv);
+    case 7u: return texture(u_textures[7], uv);
+    case 8u: return texture(u_textures[8], uv);
+    case 9u: return texture(u_textures[9], uv);
+    case 10u: return texture(u_textures[10], uv);
+    case 11u: return texture(u_textures[11], uv);
+    case 12u: return texture(u_textures[12], uv);
+    case 13u: return texture(u_textures[13], uv);
+    case 14u: return texture(u_textures[14], uv);
+    case 15u: return texture(u_textures[15], uv);
+    }
+    return vec4(1.0);
+}
+
+void main()
+{
+    o_color = v_color * SampleSlot(v_slot, v_uv);
+}
+)";
+
+        GLuint CompileShader(GLenum type, const char *source)
+        {
+            GLuint shader = glCreateShader(type);
+            glShaderSource(shader, 1, &source, nullptr);
+            glCompileShader(shader);
+
+            GLint compiled = GL_FALSE;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+            if (!compiled)
+            {
+                char log[1024] = {};
+                glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+                std::fprintf(stderr, "[Flux] ImGui renderer shader failed to compile: %s\n", log);
+                glDeleteShader(shader);
+                return 0;
+            }
+            return shader;
+        }
+
+        size_t AlignUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    } // namespace
+
+    bool ImGuiRenderer::Init()
+    {
+        // Buffer storage is 4.4, multi-draw-indirect and vertex attribute bindings 4.3
+        if (!GLAD_GL_VERSION_4_4)
+        {
+            std::fprintf(stderr, "[Flux] ImGui renderer needs OpenGL 4.4, "
+                                 "using the stock backend\n");
+            return false;
+        }
+
+        const GLuint vertex_shader = CompileShader(GL_VERTEX_SHADER, kVertexShader);
+        const GLuint fragment_shader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+        if (!vertex_shader || !fragment_shader)
+        {
+            glDeleteShader(vertex_shader);
+            glDeleteShader(fragment_shader);
+            return false;
+        }
+
+        program_ = glCreateProgram();
+        glAttachShader(program_, vertex_shader);
+        glAttachShader(program_, fragment_shader);
+        glLinkProgram(program_);
+        glDeleteShader(vertex_shader);
+        glDeleteShader(fragment_shader);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program_, GL_LINK_STATUS, &linked);
+        if (!linked)
+        {
+            char log[1024] = {};
+            glGetProgramInfoLog(program_, sizeof(log), nullptr, log);
+            std::fprintf(stderr, "[Flux] ImGui renderer program failed to link: %s\n", log);
+            glDeleteProgram(program_);
+            program_ = 0;
+            return false;
+        }
+
+        projection_location_ = glGetUniformLocation(program_, "u_projection");
+        GLint slots[kMaxTextureSlots];
+        for (uint32_t i = 0; i < kMaxTextureSlots; ++i)
+        {
+            slots[i] = static_cast<GLint>(i);
+        }
+        glUseProgram(program_);
+        glUniform1iv(glGetUniformLocation(program_, "u_textures"), kMaxTextureSlots, slots);
+        glUseProgram(0);
+
+        // Binding 0: ImDrawVert per vertex. Binding 1: DrawInstance per command.
+        glGenVertexArrays(1, &vertex_array_);
+        glBindVertexArray(vertex_array_);
+        for (GLuint attribute = 0; attribute < 5; ++attribute)
+        {
+            glEnableVertexAttribArray(attribute);
+            glVertexAttribBinding(attribute, attribute < 3 ? 0 : 1);
+        }
+        glVertexAttribFormat(0, 2, GL_FLOAT, GL_FALSE, offsetof(ImDrawVert, pos));
+        glVertexAttribFormat(1, 2, GL_FLOAT, GL_FALSE, offsetof(ImDrawVert, uv));
+        glVertexAttribFormat(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(ImDrawVert, col));
+        glVertexAttribFormat(3, 4, GL_FLOAT, GL_FALSE, offsetof(DrawInstance, clip_rect));
+        glVertexAttribIFormat(4, 1, GL_UNSIGNED_INT, offsetof(DrawInstance, slot));
+        glVertexBindingDivisor(1, 1);
+        glBindVertexArray(0);
+
+        if (!CreateRing(kInitialSegmentBytes))
+        {
+            Shutdown();
+            return false;
+        }
+        return true;
+    }
+
+    bool ImGuiRenderer::CreateRing(size_t segment_bytes)
+    {
+        segment_bytes_ = AlignUp(segment_bytes, kRegionAlignment);
+        const GLsizeiptr size = static_cast<GLsizeiptr>(segment_bytes_ * kRingSegments);
+
+        glGenBuffers(1, &ring_buffer_);
+        glBindBuffer(GL_ARRAY_BUFFER, ring_buffer_);
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+        ring_memory_ = static_cast<uint8_t *>(glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        if (!ring_memory_)
+        {
+            std::fprintf(stderr, "[Flux] ImGui renderer could not map %zu bytes\n",
+                         static_cast<size_t>(size));
+            DestroyRing();
+            return false;
+        }
+        segment_index_ = 0;
+        return true;
+    }
+
+    void ImGuiRenderer::DestroyRing()
+    {
+        for (size_t segment = 0; segment < kRingSegments; ++segment)
+        {
+            WaitForSegment(segment);
+        }
+
+        if (ring_buffer_)
+        {
+            if (ring_memory_)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, ring_buffer_);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+            }
+            glDeleteBuffers(1, &ring_buffer_);
+        }
+        ring_buffer_ = 0;
+        ring_memory_ = nullptr;
+        segment_bytes_ = 0;
+    }
+
+    void ImGuiRenderer::Shutdown()
+    {
+        DestroyRing();
+        if (vertex_array_)
+        {
+            glDeleteVertexArrays(1, &vertex_array_);
+            vertex_array_ = 0;
+        }
+        if (program_)
+        {
+            glDeleteProgram(program_);
+            program_ = 0;
+        }
+        initialized_ = false;
+    }
+
+    void ImGuiRenderer::WaitForSegment(size_t segment)
+    {
+        void *&fence = segment_fences_[segment];
+        if (fence)
+        {
+            glClientWaitSync(static_cast<GLsync>(fence), GL_SYNC_FLUSH_COMMANDS_BIT,
+                             1000000000ull);
+            glDeleteSync(static_cast<GLsync>(fence));
+            fence = nullptr;
+        }
+    }
+
+    bool ImGuiRenderer::RenderDrawData(ImDrawData *draw_data)
+    {
+        if (!initialized_ && !init_failed_)
+        {
+            initialized_ = Init();
+            init_failed_ = !initialized_;
+        }
+        if (!initialized_)
+        {
+            return false;
+        }
+
+        frame_stats_ = ImGuiRendererStats();
+        const int width = draw_data ? static_cast<int>(draw_data->DisplaySize.x *
+                                                       draw_data->FramebufferScale.x)
+                                    : 0;
+        const int height = draw_data ? static_cast<int>(draw_data->DisplaySize.y *
+                                                        draw_data->FramebufferScale.y)
+                                     : 0;
+        if (width <= 0 || height <= 0)
+        {
+            stats_ = frame_stats_;
+            return true;
+        }
+
+#if IMGUI_VERSION_NUM >= 19200
+        // Same as the stock backend: atlas pages are created and updated first
+        if (draw_data->Textures)
+        {
+            for (ImTextureData *texture : *draw_data->Textures)
+            {
+                if (texture->Status != ImTextureStatus_OK)
+                {
+                    ImGui_ImplOpenGL3_UpdateTexture(texture);
+                }
+            }
+        }
+#endif
+
+        // Regions of this frame's segment: vertices, indices, instances, commands
+        size_t command_count = 0;
+        for (const ImDrawList *draw_list : draw_data->CmdLists)
+        {
+            command_count += static_cast<size_t>(draw_list->CmdBuffer.Size);
+        }
+        const size_t vertex_bytes =
+            AlignUp(draw_data->TotalVtxCount * sizeof(ImDrawVert), kRegionAlignment);
+        const size_t index_bytes =
+            AlignUp(draw_data->TotalIdxCount * sizeof(ImDrawIdx), kRegionAlignment);
+        const size_t instance_bytes =
+            AlignUp(command_count * sizeof(DrawInstance), kRegionAlignment);
+        const size_t frame_bytes = vertex_bytes + index_bytes + instance_bytes +
+                                   command_count * sizeof(DrawElementsIndirectCommand);
+
+        if (frame_bytes > segment_bytes_)
+        {
+            // Waits for every segment; only happens while the UI grows
+            DestroyRing();
+            if (!CreateRing(frame_bytes + frame_bytes / 2))
+            {
+                Shutdown();
+                init_failed_ = true;
+                return false;
+            }
+            ++frame_stats_.ring_grows;
+        }
+        // Written kRingSegments frames ago
+        WaitForSegment(segment_index_);
+
+        vertex_offset_ = segment_index_ * segment_bytes_;
+        const size_t index_offset = vertex_offset_ + vertex_bytes;
+        instance_offset_ = index_offset + index_bytes;
+        indirect_offset_ = instance_offset_ + instance_bytes;
+
+        auto *vertices = reinterpret_cast<ImDrawVert *>(ring_memory_ + vertex_offset_);
+        auto *indices = reinterpret_cast<ImDrawIdx *>(ring_memory_ + index_offset);
+        auto *instances = reinterpret_cast<DrawInstance *>(ring_memory_ + instance_offset_);
+        auto *commands =
+            reinterpret_cast<DrawElementsIndirectCommand *>(ring_memory_ + indirect_offset_);
+
+        batches_.clear();
+        batch_textures_.clear();
+        BeginBatch(0);
+
+        // firstIndex counts from the start of the buffer, baseVertex from the
+        // vertex binding and baseInstance from the instance binding
+        const uint32_t first_index = static_cast<uint32_t>(index_offset / sizeof(ImDrawIdx));
+        uint32_t vertex_count = 0;
+        uint32_t index_count = 0;
+        uint32_t draw_count = 0;
+        for (const ImDrawList *draw_list : draw_data->CmdLists)
+        {
+            std::memcpy(vertices + vertex_count, draw_list->VtxBuffer.Data,
+                        draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+            std::memcpy(indices + index_count, draw_list->IdxBuffer.Data,
+                        draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+            for (const ImDrawCmd &command : draw_list->CmdBuffer)
+            {
+                if (command.UserCallback)
+                {
+                    Batch callback;
+                    callback.first = draw_count;
+                    callback.draw_list = draw_list;
+                    callback.callback = &command;
+                    batches_.push_back(callback);
+                    BeginBatch(draw_count);
+                    continue;
+                }
+
+                const ImVec4 &clip = command.ClipRect;
+                if (command.ElemCount == 0 || clip.z <= clip.x || clip.w <= clip.y)
+                {
+                    continue;
+                }
+
+                const auto texture_id = static_cast<uint32_t>((intptr_t)command.GetTexID());
+                instances[draw_count] = {clip, GetTextureSlot(texture_id, draw_count)};
+                commands[draw_count] = {command.ElemCount, 1,
+                                        first_index + index_count + command.IdxOffset,
+                                        static_cast<int32_t>(vertex_count + command.VtxOffset),
+                                        draw_count};
+                ++batches_.back().count;
+                ++draw_count;
+            }
+
+            vertex_count += static_cast<uint32_t>(draw_list->VtxBuffer.Size);
+            index_count += static_cast<uint32_t>(draw_list->IdxBuffer.Size);
+        }
+        frame_stats_.uploaded_bytes = vertex_count * sizeof(ImDrawVert) +
+                                      index_count * sizeof(ImDrawIdx) +
+                                      draw_count * (sizeof(DrawInstance) +
+                                                    sizeof(DrawElementsIndirectCommand));
+
+        const bool blend_was_enabled = glIsEnabled(GL_BLEND);
+        const bool depth_was_enabled = glIsEnabled(GL_DEPTH_TEST);
+        const bool cull_was_enabled = glIsEnabled(GL_CULL_FACE);
+        const bool stencil_was_enabled = glIsEnabled(GL_STENCIL_TEST);
+        const bool scissor_was_enabled = glIsEnabled(GL_SCISSOR_TEST);
+        GLint viewport[4] = {};
+        glGetIntegerv(GL_VIEWPORT, viewport);
+
+        SetupRenderState(*draw_data, width, height);
+        for (const Batch &batch : batches_)
+        {
+            if (!batch.callback)
+            {
+                DrawBatch(batch);
+                continue;
+            }
+
+            ++frame_stats_.callbacks;
+            if (batch.callback->UserCallback == ImDrawCallback_ResetRenderState)
+            {
+                SetupRenderState(*draw_data, width, height);
+            }
+            else
+            {
+                batch.callback->UserCallback(batch.draw_list, batch.callback);
+                // The callback may have bound anything to any unit
+                bound_textures_.fill(kNoTexture);
+            }
+        }
+
+        segment_fences_[segment_index_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        segment_index_ = (segment_index_ + 1) % kRingSegments;
+
+        for (GLenum plane = 0; plane < 4; ++plane)
+        {
+            glDisable(GL_CLIP_DISTANCE0 + plane);
+        }
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        glBindVertexArray(0);
+        glUseProgram(0);
+        glActiveTexture(GL_TEXTURE0);
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        blend_was_enabled ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+        depth_was_enabled ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+        cull_was_enabled ? glEnable(GL_CULL_FACE) : glDisable(GL_CULL_FACE);
+        stencil_was_enabled ? glEnable(GL_STENCIL_TEST) : glDisable(GL_STENCIL_TEST);
+        scissor_was_enabled ? glEnable(GL_SCISSOR_TEST) : glDisable(GL_SCISSOR_TEST);
+
+        stats_ = frame_stats_;
+        return true;
+    }
+
+    void ImGuiRenderer::SetupRenderState(const ImDrawData &draw_data, int width, int height)
+    {
+        glEnable(GL_BLEND);
+        glBlendEquation(GL_FUNC_ADD);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE,
+                            GL_ONE_MINUS_SRC_ALPHA);
+        glDisable(GL_CULL_FACE);
+        glDisable(GL_DEPTH_TEST);
+        glDisable(GL_STENCIL_TEST);
+        glDisable(GL_SCISSOR_TEST);
+        for (GLenum plane = 0; plane < 4; ++plane)
+        {
+            glEnable(GL_CLIP_DISTANCE0 + plane);
+        }
+        glViewport(0, 0, width, height);
+
+        const float left = draw_data.DisplayPos.x;
+        const float top = draw_data.DisplayPos.y;
+        const glm::mat4 projection = glm::ortho(left, left + draw_data.DisplaySize.x,
+                                                top + draw_data.DisplaySize.y, top, -1.0f, 1.0f);
+        glUseProgram(program_);
+        glUniformMatrix4fv(projection_location_, 1, GL_FALSE, glm::value_ptr(projection));
+
+        glBindVertexArray(vertex_array_);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ring_buffer_);
+        glBindVertexBuffer(0, ring_buffer_, static_cast<GLintptr>(vertex_offset_),
+                           sizeof(ImDrawVert));
+        glBindVertexBuffer(1, ring_buffer_, static_cast<GLintptr>(instance_offset_),
+                           sizeof(DrawInstance));
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, ring_buffer_);
+        bound_textures_.fill(kNoTexture);
+    }
+
+    void ImGuiRenderer::BeginBatch(uint32_t first)
+    {
+        Batch batch;
+        batch.first = first;
+        batch.first_texture = static_cast<uint32_t>(batch_textures_.size());
+        batches_.push_back(batch);
+    }
+
+    uint32_t ImGuiRenderer::GetTextureSlot(uint32_t texture_id, uint32_t draw_index)
+    {
+        Batch &batch = batches_.back();
+        for (uint32_t slot = 0; slot < batch.texture_count; ++slot)
+        {
+            if (batch_textures_[batch.first_texture + slot] == texture_id)
+            {
+                return slot;
+            }
+        }
+
+        if (batch.texture_count == kMaxTextureSlots)
+        {
+            BeginBatch(draw_index);
+        }
+        batch_textures_.push_back(texture_id);
+        return batches_.back().texture_count++;
+    }
+
+    void ImGuiRenderer::DrawBatch(const Batch &batch)
+    {
+        if (batch.count == 0)
+        {
+            return;
+        }
+
+        // Units keep their texture across batches, only changed slots are rebound
+        for (uint32_t slot = 0; slot < batch.texture_count; ++slot)
+        {
+            const uint32_t texture = batch_textures_[batch.first_texture + slot];
+            if (bound_textures_[slot] != texture)
+            {
+                glActiveTexture(GL_TEXTURE0 + slot);
+                glBindTexture(GL_TEXTURE_2D, texture);
+                bound_textures_[slot] = texture;
+                ++frame_stats_.texture_binds;
+            }
+        }
+
+        const size_t offset =
+            indirect_offset_ + batch.first * sizeof(DrawElementsIndirectCommand);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, kIndexType,
+                                    reinterpret_cast<const void *>(offset),
+                                    static_cast<GLsizei>(batch.count), 0);
+        ++frame_stats_.draw_calls;
+        frame_stats_.commands += batch.count;
+    }
+
+} // namespace flux
@@ -0,0 +1,116 @@
+// Copyright 2026 Beisent
+// OpenGL 4.4 ImGui renderer with persistently mapped buffers for Flux framework
+
+#ifndef FLUX_CORE_SRC_IMGUIRENDERER_HPP_
+#define FLUX_CORE_SRC_IMGUIRENDERER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <imgui.h>
+
+namespace flux
+{
+
+    enum class ImGuiRendererBackend
+    {
+        Stock, // imgui_impl_opengl3
+        Flux   // ImGuiRenderer, falls back to Stock below OpenGL 4.4
+    };
+
+    struct ImGuiRendererStats
+    {
+        uint32_t draw_calls = 0; // glMultiDrawElementsIndirect submissions
+        uint32_t commands = 0;   // ImDrawCmds drawn
+        uint32_t callbacks = 0;
+        uint32_t texture_binds = 0;
+        uint64_t uploaded_bytes = 0;
+        uint32_t ring_grows = 0; // Frames that did not fit their ring segment
+    };
+
+    // Draws the main viewport's ImDrawData without reallocating any buffer. The
+    // vertices, indices, per-command clip rects and indirect draw commands of a
+    // frame are written into one segment of a persistently mapped ring buffer of
+    // kRingSegments fenced segments. Clip rects become clip distances in the vertex
+    // shader instead of scissor changes, and commands are bound to one of 16
+    // texture units, so consecutive commands are submitted with a single
+    // glMultiDrawElementsIndirect. A batch ends at a 17th texture or a user
+    // callback.
+    //
+    // Textures stay with imgui_impl_opengl3, which keeps creating and updating them
+    // from NewFrame (and from the draw data's texture list with ImGui 1.92).
+    // Secondary viewports are drawn by the stock backend: vertex arrays are not
+    // shared between contexts. GL thread only.
+    class ImGuiRenderer
+    {
+    public:
+        static constexpr size_t kRingSegments = 3;
+        static constexpr uint32_t kMaxTextureSlots = 16;
+
+        ImGuiRenderer() = default;
+        ~ImGuiRenderer() = default;
+
+        ImGuiRenderer(const ImGuiRenderer &) = delete;
+        ImGuiRenderer &operator=(const ImGuiRenderer &) = delete;
+
+        // Creates the GL objects on first use. False without OpenGL 4.4, the
+        // caller then draws with the stock backend.
+        [[nodiscard]] bool RenderDrawData(ImDrawData *draw_data);
+        void Shutdown();
+
+        // Totals of the previous RenderDrawData()
+        [[nodiscard]] const ImGuiRendererStats &GetStats() const { return stats_; }
+
+    private:
+        // A range of indirect commands drawn with one set of textures, or a callback
+        struct Batch
+        {
+            uint32_t first = 0;
+            uint32_t count = 0;
+            uint32_t first_texture = 0; // Into batch_textures_
+            uint32_t texture_count = 0;
+            const ImDrawList *draw_list = nullptr;
+            const ImDrawCmd *callback = nullptr;
+        };
+
+        bool Init();
+        bool CreateRing(size_t segment_bytes);
+        void DestroyRing();
+        void WaitForSegment(size_t segment);
+        void SetupRenderState(const ImDrawData &draw_data, int width, int height);
+        void BeginBatch(uint32_t first);
+        // Starts a new batch at draw_index when the current one has no free slot
+        [[nodiscard]] uint32_t GetTextureSlot(uint32_t texture_id, uint32_t draw_index);
+        void DrawBatch(const Batch &batch);
+
+        bool initialized_ = false;
+        bool init_failed_ = false;
+
+        uint32_t program_ = 0;
+        uint32_t vertex_array_ = 0;
+        int projection_location_ = -1;
+
+        // Ring: kRingSegments segments of segment_bytes_, one fence each
+        uint32_t ring_buffer_ = 0;
+        uint8_t *ring_memory_ = nullptr;
+        size_t segment_bytes_ = 0;
+        size_t segment_index_ = 0;
+        std::array<void *, kRingSegments> segment_fences_{};
+
+        // Rebuilt every frame
+        std::vector<Batch> batches_;
+        std::vector<uint32_t> batch_textures_;
+        size_t vertex_offset_ = 0;
+        size_t instance_offset_ = 0;
+        size_t indirect_offset_ = 0;
+        std::array<uint32_t, kMaxTextureSlots> bound_textures_{};
+
+        ImGuiRendererStats frame_stats_;
+        ImGuiRendererStats stats_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_IMGUIRENDERER_HPP_
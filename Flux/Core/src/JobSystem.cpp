@@ -0,0 +1,308 @@
+// Copyright 2026 Beisent
+// JobSystem implementation
+
+#include "JobSystem.hpp"
+#include "Trace.hpp"
+
+#include <algorithm>
+
+namespace flux
+{
+
+    struct JobNode
+    {
+        JobSystem::Job job;
+        JobGroup *group = nullptr;
+
+        // Starts at one so the node cannot run while dependencies are still attached
+        std::atomic<uint32_t> pending_dependencies{1};
+
+        std::mutex mutex;
+        std::vector<std::shared_ptr<JobNode>> continuations;
+        std::atomic<bool> done{false};
+    };
+
+    namespace
+    {
+        thread_local const JobSystem *t_owner = nullptr;
+        thread_local size_t t_worker_index = 0;
+    } // namespace
+
+    bool JobHandle::IsDone() const
+    {
+        return !node_ || node_->done.load(std::memory_order_acquire);
+    }
+
+    JobSystem::JobSystem(uint32_t worker_count)
+    {
+        if (worker_count == 0)
+        {
+            const uint32_t hardware = std::thread::hardware_concurrency();
+            worker_count = hardware > 1 ? hardware - 1 : 1;
+        }
+
+        queues_.reserve(worker_count);
+        for (uint32_t i = 0; i < worker_count; ++i)
+        {
+            queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        workers_.reserve(worker_count);
+        for (uint32_t i = 0; i < worker_count; ++i)
+        {
+            workers_.emplace_back([this, i]() { WorkerLoop(i); });
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stopping_.store(true);
+        }
+        wake_condition_.notify_all();
+
+        for (std::thread &worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    JobHandle JobSystem::Schedule(Job job, std::initializer_list<JobHandle> dependencies,
+                                  JobGroup *group)
+    {
+        return ScheduleNode(std::move(job), dependencies.begin(), dependencies.size(), group);
+    }
+
+    JobHandle JobSystem::Schedule(Job job, const std::vector<JobHandle> &dependencies,
+                                  JobGroup *group)
+    {
+        return ScheduleNode(std::move(job), dependencies.data(), dependencies.size(), group);
+    }
+
+    JobHandle JobSystem::ScheduleNode(Job job, const JobHandle *dependencies,
+                                      size_t dependency_count, JobGroup *group)
+    {
+        auto node = std::make_shared<JobNode>();
+        node->job = std::move(job);
+        node->group = group;
+        if (group)
+        {
+            group->pending_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        for (size_t i = 0; i < dependency_count; ++i)
+        {
+            JobNode *dependency = dependencies[i].node_.get();
+            if (!dependency)
+            {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(dependency->mutex);
+            if (!dependency->done.load(std::memory_order_acquire))
+            {
+                node->pending_dependencies.fetch_add(1, std::memory_order_relaxed);
+                dependency->continuations.push_back(node);
+            }
+        }
+
+        JobHandle handle(node);
+        if (node->pending_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Enqueue(std::move(node));
+        }
+        return handle;
+    }
+
+    void JobSystem::ParallelFor(size_t count, size_t grain_size,
+                                const std::function<void(size_t begin, size_t end)> &func)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        grain_size = std::max<size_t>(grain_size, 1);
+        JobGroup group;
+        for (size_t begin = 0; begin < count; begin += grain_size)
+        {
+            const size_t end = std::min(begin + grain_size, count);
+            Schedule([&func, begin, end]() { func(begin, end); }, {}, &group);
+        }
+        Wait(group);
+    }
+
+    void JobSystem::Wait(const JobHandle &handle)
+    {
+        const bool worker = t_owner == this;
+        while (!handle.IsDone())
+        {
+            const bool ran = worker ? TryRunOne(t_worker_index)
+                                    : TryRunWaitedOn(handle.node_.get(), nullptr);
+            if (!ran)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::Wait(const JobGroup &group)
+    {
+        const bool worker = t_owner == this;
+        while (!group.IsIdle())
+        {
+            const bool ran =
+                worker ? TryRunOne(t_worker_index) : TryRunWaitedOn(nullptr, &group);
+            if (!ran)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::Enqueue(std::shared_ptr<JobNode> node)
+    {
+        // Workers keep their own continuations local, other threads spread round-robin
+        const size_t queue_index = t_owner == this
+                                       ? t_worker_index
+                                       : next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                                             queues_.size();
+        {
+            std::lock_guard<std::mutex> lock(queues_[queue_index]->mutex);
+            queues_[queue_index]->jobs.push_back(std::move(node));
+        }
+        queued_jobs_.fetch_add(1, std::memory_order_release);
+
+        // Taking the lock orders this against a worker checking the predicate
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+        }
+        wake_condition_.notify_one();
+    }
+
+    std::shared_ptr<JobNode> JobSystem::TryPop(size_t queue_index, bool steal)
+    {
+        WorkerQueue &queue = *queues_[queue_index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty())
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<JobNode> node;
+        if (steal)
+        {
+            node = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+        else
+        {
+            node = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        }
+        queued_jobs_.fetch_sub(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    bool JobSystem::TryRunOne(size_t preferred_queue)
+    {
+        // Own queue LIFO for cache locality, then steal FIFO from the others
+        std::shared_ptr<JobNode> node = TryPop(preferred_queue, false);
+        for (size_t i = 1; !node && i < queues_.size(); ++i)
+        {
+            node = TryPop((preferred_queue + i) % queues_.size(), true);
+        }
+
+        if (!node)
+        {
+            return false;
+        }
+
+        Execute(node);
+        return true;
+    }
+
+    bool JobSystem::TryRunWaitedOn(const JobNode *node, const JobGroup *group)
+    {
+        std::shared_ptr<JobNode> found;
+        for (const std::unique_ptr<WorkerQueue> &queue : queues_)
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            auto it = std::find_if(queue->jobs.begin(), queue->jobs.end(),
+                                   [&](const std::shared_ptr<JobNode> &queued)
+                                   {
+                                       return queued.get() == node ||
+                                              (group && queued->group == group);
+                                   });
+            if (it != queue->jobs.end())
+            {
+                found = std::move(*it);
+                queue->jobs.erase(it);
+                queued_jobs_.fetch_sub(1, std::memory_order_relaxed);
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            return false;
+        }
+
+        Execute(found);
+        return true;
+    }
+
+    void JobSystem::Execute(const std::shared_ptr<JobNode> &node)
+    {
+        {
+            FLUX_TRACE_SCOPE("Job");
+            node->job();
+        }
+        node->job = nullptr;
+
+        std::vector<std::shared_ptr<JobNode>> continuations;
+        {
+            std::lock_guard<std::mutex> lock(node->mutex);
+            node->done.store(true, std::memory_order_release);
+            continuations.swap(node->continuations);
+        }
+
+        for (std::shared_ptr<JobNode> &continuation : continuations)
+        {
+            if (continuation->pending_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                Enqueue(std::move(continuation));
+            }
+        }
+
+        if (node->group)
+        {
+            node->group->pending_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    void JobSystem::WorkerLoop(size_t worker_index)
+    {
+        t_owner = this;
+        t_worker_index = worker_index;
+        FLUX_TRACE_THREAD_NAME("Worker " + std::to_string(worker_index));
+
+        while (!stopping_.load(std::memory_order_acquire))
+        {
+            if (TryRunOne(worker_index))
+            {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            wake_condition_.wait(lock,
+                [this]()
+                {
+                    return stopping_.load(std::memory_order_acquire) ||
+                           queued_jobs_.load(std::memory_order_acquire) > 0;
+                });
+        }
+    }
+
+} // namespace flux
@@ -0,0 +1,112 @@
+// Copyright 2026 Beisent
+// Work-stealing job system for Flux framework
+
+#ifndef FLUX_CORE_SRC_JOBSYSTEM_HPP_
+#define FLUX_CORE_SRC_JOBSYSTEM_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace flux
+{
+
+    struct JobNode;
+
+    class JobHandle
+    {
+    public:
+        JobHandle() = default;
+
+        [[nodiscard]] bool IsValid() const { return node_ != nullptr; }
+        [[nodiscard]] bool IsDone() const;
+
+    private:
+        friend class JobSystem;
+        explicit JobHandle(std::shared_ptr<JobNode> node) : node_(std::move(node)) {}
+
+        std::shared_ptr<JobNode> node_;
+    };
+
+    // Counts outstanding jobs so a batch can be joined without tracking handles
+    class JobGroup
+    {
+    public:
+        [[nodiscard]] bool IsIdle() const { return pending_.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+        std::atomic<uint32_t> pending_{0};
+    };
+
+    class JobSystem
+    {
+    public:
+        using Job = std::function<void()>;
+
+        // worker_count == 0 picks hardware_concurrency - 1 (at least one worker)
+        explicit JobSystem(uint32_t worker_count = 0);
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        // The job runs once all dependencies have finished
+        JobHandle Schedule(Job job, std::initializer_list<JobHandle> dependencies = {},
+                           JobGroup *group = nullptr);
+        JobHandle Schedule(Job job, const std::vector<JobHandle> &dependencies,
+                           JobGroup *group = nullptr);
+
+        // Splits [0, count) into chunks of at least grain_size and blocks until done
+        void ParallelFor(size_t count, size_t grain_size,
+                         const std::function<void(size_t begin, size_t end)> &func);
+
+        // Waiting workers execute any queued job instead of idling. Other threads
+        // only run the job or group jobs they wait on, so the main thread never
+        // picks up a long background job such as an image decode.
+        void Wait(const JobHandle &handle);
+        void Wait(const JobGroup &group);
+
+        [[nodiscard]] uint32_t GetWorkerCount() const
+        {
+            return static_cast<uint32_t>(workers_.size());
+        }
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<std::shared_ptr<JobNode>> jobs;
+        };
+
+        JobHandle ScheduleNode(Job job, const JobHandle *dependencies, size_t dependency_count,
+                               JobGroup *group);
+        void Enqueue(std::shared_ptr<JobNode> node);
+        bool TryRunOne(size_t preferred_queue);
+        // Runs a queued job that is node or belongs to group
+        bool TryRunWaitedOn(const JobNode *node, const JobGroup *group);
+        std::shared_ptr<JobNode> TryPop(size_t queue_index, bool steal);
+        void Execute(const std::shared_ptr<JobNode> &node);
+        void WorkerLoop(size_t worker_index);
+
+        std::vector<std::thread> workers_;
+        std::vector<std::unique_ptr<WorkerQueue>> queues_;
+        std::atomic<size_t> next_queue_{0};
+        std::atomic<uint32_t> queued_jobs_{0};
+
+        std::mutex sleep_mutex_;
+        std::condition_variable wake_condition_;
+        std::atomic<bool> stopping_{false};
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_JOBSYSTEM_HPP_
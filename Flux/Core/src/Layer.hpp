@@ -4,31 +4,135 @@
 #ifndef FLUX_CORE_SRC_LAYER_HPP_
 #define FLUX_CORE_SRC_LAYER_HPP_
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "Event.hpp"
+#include "EventQueue.hpp"
+#include "FrameProfiler.hpp"
+#include "JobSystem.hpp"
 #include "TimeStep.hpp"
+#include "TripleBuffer.hpp"
 
 namespace flux
 {
 
+    // Refers to a layer owned by the stack. A popped layer's handle stays stale even
+    // after its slot is reused, the generation no longer matches.
+    struct LayerHandle
+    {
+        static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+        uint32_t index = kInvalidIndex;
+        uint32_t generation = 0;
+
+        [[nodiscard]] bool IsValid() const { return index != kInvalidIndex; }
+        bool operator==(const LayerHandle &other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+        bool operator!=(const LayerHandle &other) const { return !(*this == other); }
+    };
+
     class Layer
     {
     public:
+        // With threaded_update, OnUpdate runs on the update thread and hands data to
+        // OnRenderUI through a Snapshot: fill GetWriteBuffer() and Publish() in
+        // OnUpdate, Acquire() and read GetReadBuffer() in OnRenderUI
+        template <typename T>
+        using Snapshot = TripleBuffer<T>;
+
         explicit Layer(std::string_view name = "Layer") : debug_name_(name) {}
         virtual ~Layer() = default;
 
         virtual void OnAttach() {}
         virtual void OnDetach() {}
+        // With SetAsyncLoad(true), OnLoadAsync runs on a job system worker right after
+        // OnAttach (file reads, decoding, parsing; no GL or ImGui), then OnLoadComplete
+        // runs on the main thread at the start of a frame to create GPU resources.
+        // Until then the core skips the layer's update, render and event callbacks.
+        virtual void OnLoadAsync() {}
+        virtual void OnLoadComplete() {}
         virtual void OnUpdate(TimeStep ts) {}
+        // Called zero or more times per frame with a constant step when
+        // ApplicationSpecification::fixed_timestep_enabled is set
+        virtual void OnFixedUpdate(TimeStep ts) {}
         virtual void OnRenderUI() {}
         virtual void OnEvent(Event &event) {}
 
+        // Receives all events of a frame in one call. The default forwards every
+        // event not yet handled by a layer above, and matching the category mask,
+        // to OnEvent.
+        virtual void OnEvents(EventSpan events)
+        {
+            for (EventVariant &queued : events)
+            {
+                Event &event = GetEventBase(queued);
+                if (!event.handled && (event.GetCategoryFlags() & event_category_mask_))
+                {
+                    OnEvent(event);
+                }
+            }
+        }
+
+        // EventCategory bits this layer wants, the core skips the layer entirely for
+        // batches without a matching event
+        void SetEventCategoryMask(int mask) { event_category_mask_ = mask; }
+        [[nodiscard]] int GetEventCategoryMask() const { return event_category_mask_; }
+
         [[nodiscard]] const std::string &GetName() const { return debug_name_; }
+        // Invalid until the layer has been pushed
+        [[nodiscard]] LayerHandle GetHandle() const { return handle_; }
+
+        // An animating layer keeps lazy rendering from going idle
+        void SetAnimating(bool animating) { animating_ = animating; }
+        [[nodiscard]] bool IsAnimating() const { return animating_; }
+
+        // A parallel layer's OnUpdate runs on a job system worker, concurrently with
+        // other layers, so it must not touch GL or ImGui there
+        void SetParallelUpdate(bool parallel) { parallel_update_ = parallel; }
+        [[nodiscard]] bool IsParallelUpdate() const { return parallel_update_; }
+
+        // Call from the constructor, before the layer is pushed
+        void SetAsyncLoad(bool async_load) { async_load_ = async_load; }
+        [[nodiscard]] bool IsAsyncLoad() const { return async_load_; }
+        [[nodiscard]] bool IsLoaded() const { return loaded_.load(std::memory_order_acquire); }
+
+        // OnUpdate starts only after the named layers' OnUpdate has finished. Names are
+        // resolved when the layer stack changes, so call this before pushing the layer
+        // or from OnAttach.
+        void AddUpdateDependency(std::string_view layer_name)
+        {
+            update_dependencies_.emplace_back(layer_name);
+        }
+        [[nodiscard]] const std::vector<std::string> &GetUpdateDependencies() const
+        {
+            return update_dependencies_;
+        }
 
     protected:
         std::string debug_name_;
+
+    private:
+        friend class Application;
+        friend class LayerStack;
+
+        bool animating_ = false;
+        int event_category_mask_ = ~0;
+        bool parallel_update_ = false;
+        bool async_load_ = false;
+        std::atomic<bool> loaded_{true};
+        JobHandle load_job_;
+        std::vector<std::string> update_dependencies_;
+        ProfileScopeId update_scope_ = kInvalidProfileScope;
+        ProfileScopeId fixed_update_scope_ = kInvalidProfileScope;
+        ProfileScopeId render_ui_scope_ = kInvalidProfileScope;
+        const char *events_trace_name_ = nullptr;
+        LayerHandle handle_;
     };
 
 } // namespace flux
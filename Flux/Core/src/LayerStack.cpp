@@ -0,0 +1,334 @@
+// Copyright 2026 Beisent
+// LayerStack implementation
+
+#include "LayerStack.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace flux
+{
+
+    LayerHandle LayerStack::Push(std::unique_ptr<Layer> layer, uint32_t hooks, bool overlay)
+    {
+        if (!layer)
+        {
+            return LayerHandle();
+        }
+
+        uint32_t index;
+        if (!free_slots_.empty())
+        {
+            index = free_slots_.back();
+            free_slots_.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+
+        Slot &slot = slots_[index];
+        slot.layer = std::move(layer);
+        slot.hooks = hooks;
+        slot.overlay = overlay;
+        slot.attached = false;
+        slot.removing = false;
+
+        const LayerHandle handle{index, slot.generation};
+        slot.layer->handle_ = handle;
+        pending_.push_back(PendingChange{handle, false});
+        has_pending_.store(true, std::memory_order_release);
+        return handle;
+    }
+
+    bool LayerStack::Remove(LayerHandle handle)
+    {
+        Slot *slot = GetSlot(handle);
+        if (!slot || slot->removing)
+        {
+            return false;
+        }
+
+        slot->removing = true;
+        pending_.push_back(PendingChange{handle, true});
+        has_pending_.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void LayerStack::ApplyPending(const LayerCallback &attach, const LayerCallback &detach)
+    {
+        bool changed = false;
+        while (!pending_.empty())
+        {
+            // Swapped out first, the callbacks may queue more changes
+            applying_.swap(pending_);
+            for (const PendingChange &change : applying_)
+            {
+                const Slot *slot = GetSlot(change.handle);
+                if (!slot)
+                {
+                    continue; // Pushed and removed within the same batch
+                }
+
+                const uint32_t index = change.handle.index;
+                if (change.remove)
+                {
+                    if (slot->attached)
+                    {
+                        Detach(index, detach);
+                    }
+                    Release(index);
+                }
+                else if (!slot->attached && !slot->removing)
+                {
+                    Attach(index, attach);
+                }
+                changed = true;
+            }
+            applying_.clear();
+        }
+        has_pending_.store(false, std::memory_order_release);
+
+        if (changed)
+        {
+            RebuildDispatchLists();
+        }
+        retired_.clear();
+    }
+
+    void LayerStack::Clear(const LayerCallback &detach)
+    {
+        // Bottom to top, like the order the layers were attached in
+        uint32_t index = head_;
+        while (index != kNoSlot)
+        {
+            const uint32_t next = slots_[index].next;
+            Detach(index, detach);
+            Release(index);
+            index = next;
+        }
+
+        for (uint32_t slot = 0; slot < slots_.size(); ++slot)
+        {
+            if (slots_[slot].layer)
+            {
+                Release(slot);
+            }
+        }
+        pending_.clear();
+        has_pending_.store(false, std::memory_order_release);
+        RebuildDispatchLists();
+        retired_.clear();
+    }
+
+    void LayerStack::Attach(uint32_t index, const LayerCallback &attach)
+    {
+        Slot &slot = slots_[index];
+        Layer *layer = slot.layer.get();
+        if (slot.overlay)
+        {
+            Link(index, tail_);
+        }
+        else
+        {
+            Link(index, last_layer_);
+            last_layer_ = index;
+        }
+
+        auto name = names_.try_emplace(std::string_view(layer->GetName()),
+                                       NameEntry{layer->handle_, 0}).first;
+        ++name->second.count;
+        slot.attached = true;
+
+        attach(*layer);
+    }
+
+    void LayerStack::Detach(uint32_t index, const LayerCallback &detach)
+    {
+        Layer *layer = slots_[index].layer.get();
+        detach(*layer);
+
+        Unlink(index);
+        slots_[index].attached = false;
+
+        auto name = names_.find(std::string_view(layer->GetName()));
+        if (name == names_.end())
+        {
+            return;
+        }
+        const uint32_t count = --name->second.count;
+        if (count == 0)
+        {
+            names_.erase(name);
+        }
+        else if (name->second.handle == layer->handle_)
+        {
+            // Another layer with the same name takes over, lowest in the stack first.
+            // Only layers sharing a name pay for the walk.
+            names_.erase(name);
+            for (uint32_t other = head_; other != kNoSlot; other = slots_[other].next)
+            {
+                const Layer *candidate = slots_[other].layer.get();
+                if (candidate->GetName() == layer->GetName())
+                {
+                    names_.emplace(std::string_view(candidate->GetName()),
+                                   NameEntry{candidate->handle_, count});
+                    break;
+                }
+            }
+        }
+    }
+
+    void LayerStack::Release(uint32_t index)
+    {
+        Slot &slot = slots_[index];
+        retired_.push_back(std::move(slot.layer));
+        slot.attached = false;
+        slot.removing = false;
+        // Handles to the old occupant go stale
+        ++slot.generation;
+        free_slots_.push_back(index);
+    }
+
+    void LayerStack::Link(uint32_t index, uint32_t after)
+    {
+        Slot &slot = slots_[index];
+        slot.prev = after;
+        slot.next = after != kNoSlot ? slots_[after].next : head_;
+        if (slot.prev != kNoSlot)
+        {
+            slots_[slot.prev].next = index;
+        }
+        else
+        {
+            head_ = index;
+        }
+        if (slot.next != kNoSlot)
+        {
+            slots_[slot.next].prev = index;
+        }
+        else
+        {
+            tail_ = index;
+        }
+    }
+
+    void LayerStack::Unlink(uint32_t index)
+    {
+        Slot &slot = slots_[index];
+        if (slot.prev != kNoSlot)
+        {
+            slots_[slot.prev].next = slot.next;
+        }
+        else
+        {
+            head_ = slot.next;
+        }
+        if (slot.next != kNoSlot)
+        {
+            slots_[slot.next].prev = slot.prev;
+        }
+        else
+        {
+            tail_ = slot.prev;
+        }
+        // Regular layers precede overlays, so the one below is regular too
+        if (last_layer_ == index)
+        {
+            last_layer_ = slot.prev;
+        }
+        slot.prev = kNoSlot;
+        slot.next = kNoSlot;
+    }
+
+    void LayerStack::RebuildDispatchLists()
+    {
+        update_layers_.clear();
+        fixed_update_layers_.clear();
+        render_ui_layers_.clear();
+        event_layers_.clear();
+        has_parallel_update_ = false;
+
+        order_.clear();
+        for (uint32_t index = head_; index != kNoSlot; index = slots_[index].next)
+        {
+            order_.push_back(slots_[index].layer.get());
+        }
+
+        for (Layer *layer : order_)
+        {
+            // Still loading: skipped until FinishLayerLoads rebuilds the lists
+            if (!layer->IsLoaded())
+            {
+                continue;
+            }
+
+            const uint32_t hooks = slots_[layer->handle_.index].hooks;
+            if (hooks & LayerHookUpdate)
+            {
+                update_layers_.push_back(layer);
+                has_parallel_update_ = has_parallel_update_ || layer->IsParallelUpdate();
+            }
+            if (hooks & LayerHookFixedUpdate)
+            {
+                fixed_update_layers_.push_back(layer);
+            }
+            if (hooks & LayerHookRenderUI)
+            {
+                render_ui_layers_.push_back(layer);
+            }
+            if (hooks & LayerHookEvents)
+            {
+                event_layers_.push_back(layer);
+            }
+        }
+        std::reverse(event_layers_.begin(), event_layers_.end());
+
+        // Resolved once here rather than by name every frame
+        update_dependencies_.resize(update_layers_.size());
+        for (size_t i = 0; i < update_layers_.size(); ++i)
+        {
+            std::vector<uint32_t> &dependencies = update_dependencies_[i];
+            dependencies.clear();
+            for (const std::string &name : update_layers_[i]->GetUpdateDependencies())
+            {
+                auto it = std::find_if(update_layers_.begin(), update_layers_.end(),
+                    [&name](const Layer *layer) { return layer->GetName() == name; });
+                const auto dependency = static_cast<size_t>(it - update_layers_.begin());
+                if (it != update_layers_.end() && dependency != i)
+                {
+                    dependencies.push_back(static_cast<uint32_t>(dependency));
+                }
+            }
+        }
+    }
+
+    LayerStack::Slot *LayerStack::GetSlot(LayerHandle handle)
+    {
+        if (handle.index >= slots_.size())
+        {
+            return nullptr;
+        }
+        Slot &slot = slots_[handle.index];
+        return slot.layer && slot.generation == handle.generation ? &slot : nullptr;
+    }
+
+    const LayerStack::Slot *LayerStack::GetSlot(LayerHandle handle) const
+    {
+        return const_cast<LayerStack *>(this)->GetSlot(handle);
+    }
+
+    Layer *LayerStack::Get(LayerHandle handle) const
+    {
+        const Slot *slot = GetSlot(handle);
+        return slot ? slot->layer.get() : nullptr;
+    }
+
+    Layer *LayerStack::FindByName(std::string_view name) const
+    {
+        auto it = names_.find(name);
+        return it != names_.end() ? Get(it->second.handle) : nullptr;
+    }
+
+} // namespace flux
@@ -0,0 +1,209 @@
+// Copyright 2026 Beisent
+// Layer registry with stable handles and per-callback dispatch lists
+
+#ifndef FLUX_CORE_SRC_LAYERSTACK_HPP_
+#define FLUX_CORE_SRC_LAYERSTACK_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Layer.hpp"
+
+namespace flux
+{
+
+    // Per-frame callbacks a layer overrides. Each has its own dispatch list, so a
+    // layer without OnRenderUI is never visited during the ImGui phase.
+    enum LayerHook : uint32_t
+    {
+        LayerHookNone = 0,
+        LayerHookUpdate = 1 << 0,
+        LayerHookFixedUpdate = 1 << 1,
+        LayerHookRenderUI = 1 << 2,
+        LayerHookEvents = 1 << 3,
+        LayerHookAll = LayerHookUpdate | LayerHookFixedUpdate | LayerHookRenderUI | LayerHookEvents
+    };
+
+    namespace detail
+    {
+        // &T::Member names Layer's own function unless T, or a class between T and
+        // Layer, declares one. An ill-formed expression (overloads, private override)
+        // falls back to the primary template and counts as overridden.
+#define FLUX_LAYER_OVERRIDE_TRAIT(Trait, Member)                                          \
+    template <typename T, typename = void>                                                \
+    struct Trait : std::true_type                                                         \
+    {                                                                                     \
+    };                                                                                    \
+    template <typename T>                                                                 \
+    struct Trait<T, std::void_t<decltype(&T::Member)>>                                    \
+        : std::bool_constant<!std::is_same_v<decltype(&T::Member), decltype(&Layer::Member)>> \
+    {                                                                                     \
+    };
+
+        FLUX_LAYER_OVERRIDE_TRAIT(OverridesOnUpdate, OnUpdate)
+        FLUX_LAYER_OVERRIDE_TRAIT(OverridesOnFixedUpdate, OnFixedUpdate)
+        FLUX_LAYER_OVERRIDE_TRAIT(OverridesOnRenderUI, OnRenderUI)
+        FLUX_LAYER_OVERRIDE_TRAIT(OverridesOnEvent, OnEvent)
+        FLUX_LAYER_OVERRIDE_TRAIT(OverridesOnEvents, OnEvents)
+
+#undef FLUX_LAYER_OVERRIDE_TRAIT
+    } // namespace detail
+
+    // Hooks overridden by T, decided at compile time from the static type
+    template <typename T>
+    [[nodiscard]] constexpr uint32_t GetLayerHooks()
+    {
+        static_assert(std::is_base_of_v<Layer, T>, "T must derive from flux::Layer");
+        if constexpr (std::is_same_v<T, Layer>)
+        {
+            return LayerHookAll;
+        }
+        else
+        {
+            uint32_t hooks = LayerHookNone;
+            hooks |= detail::OverridesOnUpdate<T>::value ? LayerHookUpdate : LayerHookNone;
+            hooks |= detail::OverridesOnFixedUpdate<T>::value ? LayerHookFixedUpdate
+                                                              : LayerHookNone;
+            hooks |= detail::OverridesOnRenderUI<T>::value ? LayerHookRenderUI : LayerHookNone;
+            hooks |= (detail::OverridesOnEvent<T>::value || detail::OverridesOnEvents<T>::value)
+                         ? LayerHookEvents
+                         : LayerHookNone;
+            return hooks;
+        }
+    }
+
+    // Owns the layers: regular layers in push order, then overlays in push order.
+    // Handles index a slot table, names are hashed, and pushes and removals are
+    // queued until ApplyPending() so they are safe from inside any layer callback.
+    // The stack order is a list linked through the slots, so attaching and detaching
+    // a layer is O(1). The dispatch lists and GetLayers() are rebuilt once per
+    // ApplyPending() or when a layer's loading state changes, and hold plain
+    // pointers for the per-frame loops.
+    class LayerStack
+    {
+    public:
+        using LayerCallback = std::function<void(Layer &)>;
+
+        LayerStack() = default;
+        LayerStack(const LayerStack &) = delete;
+        LayerStack &operator=(const LayerStack &) = delete;
+
+        // The handle is usable right away, the layer joins the stack on the next
+        // ApplyPending()
+        LayerHandle Push(std::unique_ptr<Layer> layer, uint32_t hooks, bool overlay);
+        // Layers and overlays alike; false for a stale handle
+        bool Remove(LayerHandle handle);
+        // Safe to poll from any thread
+        [[nodiscard]] bool HasPending() const { return has_pending_.load(std::memory_order_acquire); }
+
+        // Attaches pushed layers and detaches removed ones in request order, then
+        // rebuilds the dispatch lists. Changes queued by the callbacks are applied
+        // in the same call.
+        void ApplyPending(const LayerCallback &attach, const LayerCallback &detach);
+        // Detaches every layer bottom to top; queued pushes are dropped unattached
+        void Clear(const LayerCallback &detach);
+
+        // After a layer finished loading, or anything else the lists depend on
+        void RebuildDispatchLists();
+
+        // Includes pushed layers not yet attached
+        [[nodiscard]] Layer *Get(LayerHandle handle) const;
+        // First attached layer with the name
+        [[nodiscard]] Layer *FindByName(std::string_view name) const;
+
+        // Attached layers, bottom to top. Inside ApplyPending() callbacks this is still
+        // the stack before the call; layers detached meanwhile are destroyed after it.
+        [[nodiscard]] const std::vector<Layer *> &GetLayers() const { return order_; }
+        [[nodiscard]] size_t GetSize() const { return order_.size(); }
+
+        // Loaded layers overriding the hook, bottom to top, events top to bottom
+        [[nodiscard]] const std::vector<Layer *> &GetUpdateLayers() const { return update_layers_; }
+        [[nodiscard]] const std::vector<Layer *> &GetFixedUpdateLayers() const
+        {
+            return fixed_update_layers_;
+        }
+        [[nodiscard]] const std::vector<Layer *> &GetRenderUILayers() const
+        {
+            return render_ui_layers_;
+        }
+        [[nodiscard]] const std::vector<Layer *> &GetEventLayers() const { return event_layers_; }
+
+        // Update dependencies of GetUpdateLayers()[index], as indices into that list.
+        // Names of layers not in the list are dropped, there is nothing to wait for.
+        [[nodiscard]] const std::vector<uint32_t> &GetUpdateDependencies(size_t index) const
+        {
+            return update_dependencies_[index];
+        }
+        [[nodiscard]] bool HasParallelUpdate() const { return has_parallel_update_; }
+
+    private:
+        static constexpr uint32_t kNoSlot = 0xFFFFFFFF;
+
+        struct Slot
+        {
+            std::unique_ptr<Layer> layer;
+            // Neighbours in the stack order while attached, kNoSlot at either end
+            uint32_t prev = kNoSlot;
+            uint32_t next = kNoSlot;
+            uint32_t generation = 1;
+            uint32_t hooks = LayerHookNone;
+            bool overlay = false;
+            bool attached = false;
+            bool removing = false;
+        };
+
+        struct PendingChange
+        {
+            LayerHandle handle;
+            bool remove = false;
+        };
+
+        [[nodiscard]] Slot *GetSlot(LayerHandle handle);
+        [[nodiscard]] const Slot *GetSlot(LayerHandle handle) const;
+        // By slot index, the callbacks may push layers and grow slots_
+        void Attach(uint32_t index, const LayerCallback &attach);
+        void Detach(uint32_t index, const LayerCallback &detach);
+        void Release(uint32_t index);
+        void Link(uint32_t index, uint32_t after);
+        void Unlink(uint32_t index);
+
+        std::vector<Slot> slots_;
+        std::vector<uint32_t> free_slots_;
+        std::vector<PendingChange> pending_;
+        std::vector<PendingChange> applying_;
+        std::atomic<bool> has_pending_{false};
+
+        uint32_t head_ = kNoSlot;       // Bottom layer
+        uint32_t tail_ = kNoSlot;       // Top overlay, or top layer without overlays
+        uint32_t last_layer_ = kNoSlot; // Top regular layer, overlays start after it
+        std::vector<Layer *> order_;
+        // Released during ApplyPending(), destroyed once order_ no longer lists them
+        std::vector<std::unique_ptr<Layer>> retired_;
+
+        // The layer FindByName() returns and how many attached layers share the name.
+        // Keys view that layer's own name, which lives as long as the entry.
+        struct NameEntry
+        {
+            LayerHandle handle;
+            uint32_t count = 0;
+        };
+        std::unordered_map<std::string_view, NameEntry> names_;
+
+        std::vector<Layer *> update_layers_;
+        std::vector<Layer *> fixed_update_layers_;
+        std::vector<Layer *> render_ui_layers_;
+        std::vector<Layer *> event_layers_;
+        std::vector<std::vector<uint32_t>> update_dependencies_;
+        bool has_parallel_update_ = false;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_LAYERSTACK_HPP_
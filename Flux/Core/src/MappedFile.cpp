@@ -0,0 +1,145 @@
+// Copyright 2026 Beisent
+// MappedFile implementation
+
+#include "MappedFile.hpp"
+
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace flux
+{
+
+    MappedFile::~MappedFile() { Close(); }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept { *this = std::move(other); }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#if defined(_WIN32)
+            mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+#if defined(_WIN32)
+
+    bool MappedFile::Open(const std::string &path)
+    {
+        Close();
+
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        // The mapping keeps the file open, the file handle itself is not needed
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping)
+        {
+            return false;
+        }
+
+        void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            CloseHandle(mapping);
+            return false;
+        }
+
+        mapping_ = mapping;
+        data_ = static_cast<const uint8_t *>(view);
+        size_ = static_cast<size_t>(size.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (data_)
+        {
+            UnmapViewOfFile(data_);
+            data_ = nullptr;
+        }
+        if (mapping_)
+        {
+            CloseHandle(static_cast<HANDLE>(mapping_));
+            mapping_ = nullptr;
+        }
+        size_ = 0;
+    }
+
+#else
+
+    bool MappedFile::Open(const std::string &path)
+    {
+        Close();
+
+        const int file = open(path.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            return false;
+        }
+
+        struct stat info{};
+        if (fstat(file, &info) != 0 || info.st_size <= 0)
+        {
+            close(file);
+            return false;
+        }
+
+        // The mapping stays valid after the descriptor is closed
+        void *view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE,
+                          file, 0);
+        close(file);
+        if (view == MAP_FAILED)
+        {
+            return false;
+        }
+
+        data_ = static_cast<const uint8_t *>(view);
+        size_ = static_cast<size_t>(info.st_size);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (data_)
+        {
+            munmap(const_cast<uint8_t *>(data_), size_);
+            data_ = nullptr;
+        }
+        size_ = 0;
+    }
+
+#endif
+
+} // namespace flux
@@ -0,0 +1,44 @@
+// Copyright 2026 Beisent
+// Read-only memory-mapped file for Flux framework
+
+#ifndef FLUX_CORE_SRC_MAPPEDFILE_HPP_
+#define FLUX_CORE_SRC_MAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace flux
+{
+
+    // Maps a whole file read-only: mmap on POSIX, CreateFileMapping on Windows.
+    // Pages are loaded lazily by the OS, so opening large files is cheap.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        bool Open(const std::string &path);
+        void Close();
+
+        [[nodiscard]] bool IsOpen() const { return data_ != nullptr; }
+        [[nodiscard]] const uint8_t *GetData() const { return data_; }
+        [[nodiscard]] size_t GetSize() const { return size_; }
+
+    private:
+        const uint8_t *data_ = nullptr;
+        size_t size_ = 0;
+#if defined(_WIN32)
+        void *mapping_ = nullptr;
+#endif
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_MAPPEDFILE_HPP_
@@ -0,0 +1,180 @@
+// Copyright 2026 Beisent
+// ProfilerLayer implementation
+
+#include "ProfilerLayer.hpp"
+
+#include <imgui.h>
+
+namespace flux
+{
+
+    ProfilerLayer::ProfilerLayer(FrameProfiler &profiler, const GpuProfiler *gpu_profiler,
+                                 float frame_budget_ms)
+        : Layer("Profiler"),
+          profiler_(profiler),
+          gpu_profiler_(gpu_profiler),
+          frame_budget_ms_(frame_budget_ms)
+    {
+    }
+
+    void ProfilerLayer::OnRenderUI()
+    {
+        if (!visible_)
+        {
+            return;
+        }
+
+        const size_t history = profiler_.GetFrameHistoryCount();
+
+        ImGui::SetNextWindowSize(ImVec2(520.0f, 420.0f), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin("Flux Profiler", &visible_))
+        {
+            ImGui::End();
+            return;
+        }
+
+        // Oldest to newest so the graph scrolls left
+        int sample_count = 0;
+        for (size_t i = history; i-- > 0;)
+        {
+            if (profiler_.CopyFrame(i, frame_record_))
+            {
+                frame_times_[sample_count++] = frame_record_.total_ms;
+            }
+        }
+
+        const ProfileScopeStats frame = profiler_.ComputeFrameStats(history);
+        ImGui::Text("Frame: %.2f ms (avg %.2f, p95 %.2f, p99 %.2f) over %d frames",
+                    frame.last_ms, frame.average_ms, frame.p95_ms, frame.p99_ms,
+                    sample_count);
+        ImGui::PlotLines("##FrameTimes", frame_times_.data(), sample_count, 0, nullptr, 0.0f,
+                         frame_budget_ms_ * 2.0f, ImVec2(0.0f, 60.0f));
+
+        if (allocations_ && AllocationTracker::IsEnabled())
+        {
+            ImGui::Text("Heap: %llu allocations, %.1f KB last frame",
+                        static_cast<unsigned long long>(allocations_->allocations),
+                        static_cast<double>(allocations_->bytes) / 1024.0);
+        }
+        if (arena_)
+        {
+            ImGui::Text("Frame arena: %.1f / %.1f KB (peak %.1f KB)",
+                        static_cast<double>(arena_->GetUsedBytes()) / 1024.0,
+                        static_cast<double>(arena_->GetCapacity()) / 1024.0,
+                        static_cast<double>(arena_->GetPeakBytes()) / 1024.0);
+        }
+        if (renderer2d_stats_ && renderer2d_stats_->draw_calls > 0)
+        {
+            const Renderer2DStats &stats = *renderer2d_stats_;
+            ImGui::Text("2D: %u draws, %u quads, %u lines, %u circles, %.1f MB",
+                        stats.draw_calls, stats.quads, stats.lines, stats.circles,
+                        static_cast<double>(stats.uploaded_bytes) / (1024.0 * 1024.0));
+        }
+        if (imgui_renderer_stats_ && imgui_renderer_stats_->draw_calls > 0)
+        {
+            const ImGuiRendererStats &stats = *imgui_renderer_stats_;
+            ImGui::Text("ImGui: %u indirect draws, %u commands, %u texture binds, %.1f KB",
+                        stats.draw_calls, stats.commands, stats.texture_binds,
+                        static_cast<double>(stats.uploaded_bytes) / 1024.0);
+        }
+        if (viewport_stats_ && !viewport_stats_->viewports.empty())
+        {
+            const ViewportRendererStats &stats = *viewport_stats_;
+            ImGui::Text("Viewports: %u drawn, %u unchanged, %u hidden, %.2f ms", stats.rendered,
+                        stats.unchanged, stats.hidden, stats.total_ms);
+            for (const ViewportRenderStats &viewport : stats.viewports)
+            {
+                if (viewport.result == ViewportRenderResult::Rendered)
+                {
+                    ImGui::TextDisabled("  %08X: draw %.2f ms, swap %.2f ms", viewport.id,
+                                        viewport.render_ms, viewport.swap_ms);
+                }
+            }
+        }
+
+        const bool show_gpu = gpu_profiler_ && gpu_profiler_->IsSupported();
+        if (!show_gpu)
+        {
+            ImGui::TextDisabled("GPU timing unavailable (no timer queries or software GL)");
+        }
+
+        DrawScopeTable("ProfilerScopes", profiler_, show_gpu ? gpu_profiler_ : nullptr, false);
+
+        if (update_profiler_ && update_profiler_->GetFrameHistoryCount() > 0)
+        {
+            const ProfileScopeStats tick = update_profiler_->ComputeFrameStats(
+                update_profiler_->GetFrameHistoryCount());
+            ImGui::Text("Update thread: %.2f ms per tick (p95 %.2f, p99 %.2f)", tick.last_ms,
+                        tick.p95_ms, tick.p99_ms);
+            DrawScopeTable("ProfilerUpdateScopes", *update_profiler_, nullptr, true);
+        }
+
+        ImGui::End();
+    }
+
+    void ProfilerLayer::DrawScopeTable(const char *table_id, const FrameProfiler &profiler,
+                                       const GpuProfiler *gpu_profiler, bool skip_idle)
+    {
+        const size_t history = profiler.GetFrameHistoryCount();
+        const ImGuiTableFlags table_flags =
+            ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable;
+        if (!ImGui::BeginTable(table_id, gpu_profiler ? 8 : 6, table_flags))
+        {
+            return;
+        }
+
+        ImGui::TableSetupColumn("Scope");
+        ImGui::TableSetupColumn("Last");
+        ImGui::TableSetupColumn("p50");
+        ImGui::TableSetupColumn("p95");
+        ImGui::TableSetupColumn("p99");
+        ImGui::TableSetupColumn("Max");
+        if (gpu_profiler)
+        {
+            ImGui::TableSetupColumn("GPU");
+            ImGui::TableSetupColumn("GPU avg");
+        }
+        ImGui::TableHeadersRow();
+
+        const ImVec4 over_budget(1.0f, 0.35f, 0.3f, 1.0f);
+        for (size_t id = 0; id < profiler.GetScopeCount(); ++id)
+        {
+            const auto scope_id = static_cast<ProfileScopeId>(id);
+            const ProfileScopeStats stats = profiler.ComputeScopeStats(scope_id, history);
+            if (skip_idle && stats.max_ms <= 0.0f)
+            {
+                continue;
+            }
+            const std::string_view name = profiler.GetScopeName(scope_id);
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(name.data(), name.data() + name.size());
+
+            const float values[] = {stats.last_ms, stats.p50_ms, stats.p95_ms, stats.p99_ms,
+                                    stats.max_ms};
+            for (float value : values)
+            {
+                ImGui::TableNextColumn();
+                if (value > frame_budget_ms_)
+                {
+                    ImGui::TextColored(over_budget, "%.3f", value);
+                }
+                else
+                {
+                    ImGui::Text("%.3f", value);
+                }
+            }
+
+            if (gpu_profiler)
+            {
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", gpu_profiler->GetLastMilliseconds(scope_id));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", gpu_profiler->GetAverageMilliseconds(scope_id));
+            }
+        }
+        ImGui::EndTable();
+    }
+
+} // namespace flux
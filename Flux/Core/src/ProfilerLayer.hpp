@@ -0,0 +1,74 @@
+// Copyright 2026 Beisent
+// Built-in profiler overlay layer
+
+#ifndef FLUX_CORE_SRC_PROFILERLAYER_HPP_
+#define FLUX_CORE_SRC_PROFILERLAYER_HPP_
+
+#include <array>
+
+#include "AllocationTracker.hpp"
+#include "FrameArena.hpp"
+#include "FrameProfiler.hpp"
+#include "GpuProfiler.hpp"
+#include "ImGuiRenderer.hpp"
+#include "Layer.hpp"
+#include "Renderer2D.hpp"
+#include "ViewportRenderer.hpp"
+
+namespace flux
+{
+
+    class ProfilerLayer : public Layer
+    {
+    public:
+        // gpu_profiler may be null, GPU columns then stay empty
+        ProfilerLayer(FrameProfiler &profiler, const GpuProfiler *gpu_profiler,
+                      float frame_budget_ms = 16.6f);
+
+        void OnRenderUI() override;
+
+        // Shows heap allocations and arena usage of the previous frame, both optional
+        void SetFrameAllocations(const AllocationCounts *allocations, const FrameArena *arena)
+        {
+            allocations_ = allocations;
+            arena_ = arena;
+        }
+
+        // Draw calls and primitives of the previous frame, shown once anything was drawn
+        void SetRenderer2DStats(const Renderer2DStats *stats) { renderer2d_stats_ = stats; }
+        void SetImGuiRendererStats(const ImGuiRendererStats *stats)
+        {
+            imgui_renderer_stats_ = stats;
+        }
+        // Cost of each secondary viewport window, shown while there are any
+        void SetViewportStats(const ViewportRendererStats *stats) { viewport_stats_ = stats; }
+        // Scopes timed on the update thread with threaded_update, shown in their own
+        // table once it has recorded frames
+        void SetUpdateProfiler(const FrameProfiler *profiler) { update_profiler_ = profiler; }
+
+        void SetVisible(bool visible) { visible_ = visible; }
+        [[nodiscard]] bool IsVisible() const { return visible_; }
+
+    private:
+        // skip_idle hides scopes that recorded nothing over the history
+        void DrawScopeTable(const char *table_id, const FrameProfiler &profiler,
+                            const GpuProfiler *gpu_profiler, bool skip_idle);
+
+        FrameProfiler &profiler_;
+        const FrameProfiler *update_profiler_ = nullptr;
+        const GpuProfiler *gpu_profiler_;
+        const AllocationCounts *allocations_ = nullptr;
+        const FrameArena *arena_ = nullptr;
+        const Renderer2DStats *renderer2d_stats_ = nullptr;
+        const ImGuiRendererStats *imgui_renderer_stats_ = nullptr;
+        const ViewportRendererStats *viewport_stats_ = nullptr;
+        float frame_budget_ms_;
+        bool visible_ = true;
+
+        std::array<float, FrameProfiler::kHistorySize> frame_times_{};
+        FrameProfiler::FrameRecord frame_record_; // Reused so copies do not allocate
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_PROFILERLAYER_HPP_
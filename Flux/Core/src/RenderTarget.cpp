@@ -0,0 +1,325 @@
+// Copyright 2026 Beisent
+// RenderTarget and RenderTargetPool implementation
+
+#include "RenderTarget.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include <glad/glad.h>
+
+namespace flux
+{
+
+    uint64_t RenderTargetAttachments::GetByteSize() const
+    {
+        const uint64_t pixels = static_cast<uint64_t>(width) * height;
+        const uint64_t samples_per_pixel = static_cast<uint64_t>(std::max(samples, 1));
+        uint64_t bytes = pixels * 4; // Resolved or single-sample color texture
+        if (samples > 0)
+        {
+            bytes += pixels * 4 * samples_per_pixel;
+        }
+        if (depth)
+        {
+            bytes += pixels * 4 * samples_per_pixel;
+        }
+        return bytes;
+    }
+
+    RenderTargetAttachments RenderTargetPool::Acquire(uint32_t width, uint32_t height,
+                                                      int samples, bool depth)
+    {
+        auto it = std::find_if(free_.begin(), free_.end(),
+            [&](const RenderTargetAttachments &pooled)
+            {
+                return pooled.width == width && pooled.height == height &&
+                       pooled.samples == samples && pooled.depth == depth;
+            });
+        if (it != free_.end())
+        {
+            RenderTargetAttachments attachments = *it;
+            *it = free_.back();
+            free_.pop_back();
+            stats_.pooled = static_cast<uint32_t>(free_.size());
+            stats_.pooled_bytes -= attachments.GetByteSize();
+            ++stats_.reuses;
+            return attachments;
+        }
+
+        RenderTargetAttachments attachments;
+        attachments.width = width;
+        attachments.height = height;
+        attachments.samples = samples;
+        attachments.depth = depth;
+        if (!Create(attachments))
+        {
+            std::fprintf(stderr, "[Flux] Failed to create %ux%u render target (%d samples)\n",
+                         width, height, samples);
+            Destroy(attachments);
+            return RenderTargetAttachments();
+        }
+        ++stats_.allocations;
+        return attachments;
+    }
+
+    void RenderTargetPool::Release(RenderTargetAttachments attachments)
+    {
+        if (!attachments.IsValid() || shut_down_)
+        {
+            return;
+        }
+
+        attachments.released_frame = frame_;
+        stats_.pooled_bytes += attachments.GetByteSize();
+        free_.push_back(attachments);
+        stats_.pooled = static_cast<uint32_t>(free_.size());
+    }
+
+    void RenderTargetPool::Update(uint64_t frame)
+    {
+        frame_ = frame;
+        for (size_t i = 0; i < free_.size();)
+        {
+            if (free_[i].released_frame + kKeepFrames < frame)
+            {
+                stats_.pooled_bytes -= free_[i].GetByteSize();
+                Destroy(free_[i]);
+                free_[i] = free_.back();
+                free_.pop_back();
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        stats_.pooled = static_cast<uint32_t>(free_.size());
+    }
+
+    void RenderTargetPool::Shutdown()
+    {
+        for (RenderTargetAttachments &attachments : free_)
+        {
+            Destroy(attachments);
+        }
+        free_.clear();
+        stats_.pooled = 0;
+        stats_.pooled_bytes = 0;
+        shut_down_ = true;
+    }
+
+    bool RenderTargetPool::Create(RenderTargetAttachments &attachments)
+    {
+        const GLsizei width = static_cast<GLsizei>(attachments.width);
+        const GLsizei height = static_cast<GLsizei>(attachments.height);
+
+        GLint previous_framebuffer = 0;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_framebuffer);
+
+        glGenTextures(1, &attachments.color_texture);
+        glBindTexture(GL_TEXTURE_2D, attachments.color_texture);
+        // Immutable storage, the size never changes for this set
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glGenFramebuffers(1, &attachments.framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, attachments.framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                               attachments.color_texture, 0);
+
+        const bool multisampled = attachments.samples > 0;
+        if (attachments.depth)
+        {
+            glGenRenderbuffers(1, &attachments.depth_renderbuffer);
+            glBindRenderbuffer(GL_RENDERBUFFER, attachments.depth_renderbuffer);
+            glRenderbufferStorageMultisample(GL_RENDERBUFFER, std::max(attachments.samples, 0),
+                                             GL_DEPTH24_STENCIL8, width, height);
+            glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        }
+
+        bool complete = true;
+        if (multisampled)
+        {
+            complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+            glGenRenderbuffers(1, &attachments.msaa_color);
+            glBindRenderbuffer(GL_RENDERBUFFER, attachments.msaa_color);
+            glRenderbufferStorageMultisample(GL_RENDERBUFFER, attachments.samples, GL_RGBA8,
+                                             width, height);
+            glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+            glGenFramebuffers(1, &attachments.msaa_framebuffer);
+            glBindFramebuffer(GL_FRAMEBUFFER, attachments.msaa_framebuffer);
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                                      attachments.msaa_color);
+        }
+
+        // Depth goes where the scene is drawn, the resolve target needs none
+        if (attachments.depth)
+        {
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+                                      GL_RENDERBUFFER, attachments.depth_renderbuffer);
+        }
+        complete = complete &&
+                   glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+        glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_framebuffer));
+        return complete;
+    }
+
+    void RenderTargetPool::Destroy(RenderTargetAttachments &attachments)
+    {
+        if (attachments.msaa_framebuffer)
+        {
+            glDeleteFramebuffers(1, &attachments.msaa_framebuffer);
+        }
+        if (attachments.framebuffer)
+        {
+            glDeleteFramebuffers(1, &attachments.framebuffer);
+        }
+        if (attachments.msaa_color)
+        {
+            glDeleteRenderbuffers(1, &attachments.msaa_color);
+        }
+        if (attachments.depth_renderbuffer)
+        {
+            glDeleteRenderbuffers(1, &attachments.depth_renderbuffer);
+        }
+        if (attachments.color_texture)
+        {
+            glDeleteTextures(1, &attachments.color_texture);
+        }
+        attachments = RenderTargetAttachments();
+    }
+
+    RenderTarget::RenderTarget(RenderTargetPool &pool,
+                               const RenderTargetSpecification &specification)
+        : pool_(pool), specification_(specification)
+    {
+        specification_.samples = std::max(specification_.samples, 0);
+        specification_.size_step = std::max<uint32_t>(specification_.size_step, 1);
+        specification_.shrink_fraction = std::clamp(specification_.shrink_fraction, 0.0f, 1.0f);
+        Resize(specification_.width, specification_.height);
+    }
+
+    RenderTarget::~RenderTarget()
+    {
+        if (bound_)
+        {
+            Unbind();
+        }
+        pool_.Release(std::exchange(attachments_, RenderTargetAttachments()));
+    }
+
+    uint32_t RenderTarget::RoundUp(uint32_t size) const
+    {
+        const uint32_t step = specification_.size_step;
+        return (size + step - 1) / step * step;
+    }
+
+    bool RenderTarget::Resize(uint32_t width, uint32_t height)
+    {
+        width = std::max<uint32_t>(width, 1);
+        height = std::max<uint32_t>(height, 1);
+        width_ = width;
+        height_ = height;
+
+        if (attachments_.IsValid())
+        {
+            const float shrink = specification_.shrink_fraction;
+            const bool fits = width <= attachments_.width && height <= attachments_.height;
+            const bool oversized =
+                static_cast<float>(width) < static_cast<float>(attachments_.width) * shrink ||
+                static_cast<float>(height) < static_cast<float>(attachments_.height) * shrink;
+            if (fits && !oversized)
+            {
+                return false;
+            }
+        }
+
+        pool_.Release(std::exchange(attachments_, RenderTargetAttachments()));
+        attachments_ = pool_.Acquire(RoundUp(width), RoundUp(height), specification_.samples,
+                                     specification_.depth);
+        ++reallocations_;
+        return true;
+    }
+
+    void RenderTarget::Bind()
+    {
+        if (!attachments_.IsValid())
+        {
+            return;
+        }
+
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_framebuffer_);
+        glGetIntegerv(GL_VIEWPORT, previous_viewport_);
+        glBindFramebuffer(GL_FRAMEBUFFER, attachments_.samples > 0
+                                              ? attachments_.msaa_framebuffer
+                                              : attachments_.framebuffer);
+        glViewport(0, 0, static_cast<GLsizei>(width_), static_cast<GLsizei>(height_));
+        bound_ = true;
+        pool_.CountBind();
+    }
+
+    void RenderTarget::Unbind()
+    {
+        if (!bound_)
+        {
+            return;
+        }
+
+        if (attachments_.samples > 0)
+        {
+            const GLint width = static_cast<GLint>(width_);
+            const GLint height = static_cast<GLint>(height_);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, attachments_.msaa_framebuffer);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, attachments_.framebuffer);
+            glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT,
+                              GL_NEAREST);
+        }
+
+        glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous_framebuffer_));
+        glViewport(previous_viewport_[0], previous_viewport_[1], previous_viewport_[2],
+                   previous_viewport_[3]);
+        bound_ = false;
+    }
+
+    void RenderTarget::Clear(float r, float g, float b, float a)
+    {
+        glClearColor(r, g, b, a);
+        GLbitfield mask = GL_COLOR_BUFFER_BIT;
+        if (specification_.depth)
+        {
+            mask |= GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT;
+        }
+        // The whole storage, so linear filtering at the edge never picks up stale texels
+        glClear(mask);
+    }
+
+    ImVec2 RenderTarget::GetUV0() const
+    {
+        const float v = attachments_.height
+                            ? static_cast<float>(height_) / static_cast<float>(attachments_.height)
+                            : 1.0f;
+        return ImVec2(0.0f, v);
+    }
+
+    ImVec2 RenderTarget::GetUV1() const
+    {
+        const float u = attachments_.width
+                            ? static_cast<float>(width_) / static_cast<float>(attachments_.width)
+                            : 1.0f;
+        return ImVec2(u, 0.0f);
+    }
+
+    void RenderTarget::Image(const ImVec2 &size) const
+    {
+        ImGui::Image(GetImTextureID(), size, GetUV0(), GetUV1());
+    }
+
+} // namespace flux
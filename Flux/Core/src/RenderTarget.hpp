@@ -0,0 +1,165 @@
+// Copyright 2026 Beisent
+// Offscreen render targets for Flux framework
+
+#ifndef FLUX_CORE_SRC_RENDERTARGET_HPP_
+#define FLUX_CORE_SRC_RENDERTARGET_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <imgui.h>
+
+namespace flux
+{
+
+    struct RenderTargetSpecification
+    {
+        uint32_t width = 1;
+        uint32_t height = 1;
+        int samples = -1; // -1 = ApplicationSpecification::msaa_samples, 0 = no MSAA
+        bool depth = true; // Depth24/stencil8 attachment
+
+        // Storage grows in steps of size_step pixels and only shrinks once the
+        // requested size falls below shrink_fraction of it, so a drag resize keeps
+        // rendering into the same attachments
+        uint32_t size_step = 64;
+        float shrink_fraction = 0.5f;
+    };
+
+    // GL objects backing one storage size, recycled through the pool
+    struct RenderTargetAttachments
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        int samples = 0;
+        bool depth = false;
+
+        uint32_t framebuffer = 0;   // Sampled: color texture (+ depth without MSAA)
+        uint32_t color_texture = 0;
+        uint32_t msaa_framebuffer = 0; // Rendered into when samples > 0
+        uint32_t msaa_color = 0;
+        uint32_t depth_renderbuffer = 0;
+        uint64_t released_frame = 0;
+
+        [[nodiscard]] bool IsValid() const { return framebuffer != 0; }
+        [[nodiscard]] uint64_t GetByteSize() const;
+    };
+
+    struct RenderTargetPoolStats
+    {
+        uint32_t pooled = 0;
+        uint64_t pooled_bytes = 0;
+        uint64_t allocations = 0; // Attachment sets created
+        uint64_t reuses = 0;      // Served from the pool instead
+        uint64_t binds = 0;       // Renders into any target, their images may have changed
+    };
+
+    // Attachment sets released by resized or destroyed targets wait here for
+    // keep_frames frames, so sizes a drag passes through again are reused and the
+    // texture of a target resized mid-frame stays alive for that frame's ImGui draw.
+    // GL thread only.
+    class RenderTargetPool
+    {
+    public:
+        static constexpr uint64_t kKeepFrames = 120;
+
+        RenderTargetPool() = default;
+        ~RenderTargetPool() = default;
+
+        RenderTargetPool(const RenderTargetPool &) = delete;
+        RenderTargetPool &operator=(const RenderTargetPool &) = delete;
+
+        [[nodiscard]] RenderTargetAttachments Acquire(uint32_t width, uint32_t height,
+                                                      int samples, bool depth);
+        void Release(RenderTargetAttachments attachments);
+
+        // Once per frame, deletes sets released more than kKeepFrames ago
+        void Update(uint64_t frame);
+        // Deletes everything; later releases are dropped, the context is gone
+        void Shutdown();
+        // Called by RenderTarget::Bind()
+        void CountBind() { ++stats_.binds; }
+
+        [[nodiscard]] const RenderTargetPoolStats &GetStats() const { return stats_; }
+
+    private:
+        static bool Create(RenderTargetAttachments &attachments);
+        static void Destroy(RenderTargetAttachments &attachments);
+
+        std::vector<RenderTargetAttachments> free_;
+        uint64_t frame_ = 0;
+        bool shut_down_ = false;
+        RenderTargetPoolStats stats_;
+    };
+
+    // A framebuffer a layer renders its scene into and shows with Image(), which
+    // samples the color texture directly. Create through
+    // Application::CreateRenderTarget and use from the GL thread.
+    //
+    //     target_->Resize(size.x, size.y);   // ImGui::GetContentRegionAvail()
+    //     target_->Bind();
+    //     target_->Clear(0.1f, 0.1f, 0.1f, 1.0f);
+    //     DrawScene();
+    //     target_->Unbind();                 // Resolves MSAA
+    //     target_->Image(size);
+    class RenderTarget
+    {
+    public:
+        RenderTarget(RenderTargetPool &pool, const RenderTargetSpecification &specification);
+        ~RenderTarget();
+
+        RenderTarget(const RenderTarget &) = delete;
+        RenderTarget &operator=(const RenderTarget &) = delete;
+
+        // Cheap when the storage still fits, true when the attachments changed
+        bool Resize(uint32_t width, uint32_t height);
+        bool Resize(const ImVec2 &size)
+        {
+            return Resize(static_cast<uint32_t>(size.x > 1.0f ? size.x : 1.0f),
+                          static_cast<uint32_t>(size.y > 1.0f ? size.y : 1.0f));
+        }
+
+        // Viewport is set to the logical size, the previous framebuffer and
+        // viewport come back on Unbind()
+        void Bind();
+        void Unbind();
+        // Color and, with a depth attachment, depth and stencil of the bound target
+        void Clear(float r, float g, float b, float a);
+
+        [[nodiscard]] uint32_t GetWidth() const { return width_; }
+        [[nodiscard]] uint32_t GetHeight() const { return height_; }
+        [[nodiscard]] uint32_t GetStorageWidth() const { return attachments_.width; }
+        [[nodiscard]] uint32_t GetStorageHeight() const { return attachments_.height; }
+        [[nodiscard]] int GetSamples() const { return specification_.samples; }
+        [[nodiscard]] uint32_t GetColorAttachment() const { return attachments_.color_texture; }
+        [[nodiscard]] ImTextureID GetImTextureID() const
+        {
+            return (ImTextureID)(intptr_t)attachments_.color_texture;
+        }
+        // Texture coordinates of the logical area, flipped for ImGui's top-left origin
+        [[nodiscard]] ImVec2 GetUV0() const;
+        [[nodiscard]] ImVec2 GetUV1() const;
+        // Storage reallocations since creation, for spotting resize storms
+        [[nodiscard]] uint64_t GetReallocationCount() const { return reallocations_; }
+
+        // ImGui::Image of the logical area
+        void Image(const ImVec2 &size) const;
+
+    private:
+        [[nodiscard]] uint32_t RoundUp(uint32_t size) const;
+
+        RenderTargetPool &pool_;
+        RenderTargetSpecification specification_;
+        RenderTargetAttachments attachments_;
+        uint32_t width_ = 0;
+        uint32_t height_ = 0;
+        uint64_t reallocations_ = 0;
+
+        bool bound_ = false;
+        int previous_framebuffer_ = 0;
+        int previous_viewport_[4] = {};
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_RENDERTARGET_HPP_
@@ -0,0 +1,583 @@
+// Copyright 2026 Beisent
+// Renderer2D implementation
+
+#include "Renderer2D.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include <glad/glad.h>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "TextureManager.hpp"
+
+namespace flux
+{
+
+    namespace
+    {
+        // Per instance: shape vec4, extra vec4, rotation float, color and kind uints
+        constexpr size_t kInstanceBytes = 16 + 16 + 4 + 4 + 4;
+        constexpr size_t kStreamAlignment = 16;
+
+        // shape: quad center.xy + half size.zw, line from.xy + to.zw, circle
+        // center.xy + radius.z. extra: quad uv rect, line thickness.x, circle
+        // thickness.x + fade.y.
+        constexpr const char *kVertexShader = R"(#version 430 core
+layout(location = 0) in vec4 a_shape;
+layout(location = 1) in vec4 a_extra;
+layout(location = 2) in float a_rotation;
+layout(location = 3) in vec4 a_color;
+layout(location = 4) in uint a_kind;
+
+uniform mat4 u_view_projection;
+
+out vec2 v_local;
+out vec2 v_uv;
+out vec4 v_color;
+flat out uint v_kind;
+flat out vec2 v_params;
+
+void main()
+{
+    vec2 corner = vec2((gl_VertexID & 1) != 0 ? 1.0 : -1.0, (gl_VertexID & 2) != 0 ? 1.0 : -1.0);
+    uint kind = a_kind & 3u;
+    vec2 position;
+    if (kind == 1u)
+    {
+        vec2 direction = a_shape.zw - a_shape.xy;
+        float len = length(direction);
+        vec2 along = len > 0.0 ? direction / len : vec2(1.0, 0.0);
+        vec2 normal = vec2(-along.y, along.x);
+        position = (a_shape.xy + a_shape.zw) * 0.5 + along * (corner.x * len * 0.5) +
+                   normal * (corner.y * a_extra.x * 0.5);
+    }
+    else
+    {
+        vec2 offset = corner * (kind == 2u ? vec2(a_shape.z) : a_shape.zw);
+        float s = sin(a_rotation);
+        float c = cos(a_rotation);
+        position = a_shape.xy + vec2(offset.x * c - offset.y * s, offset.x * s + offset.y * c);
+    }
+
+    v_local = corner;
+    v_uv = mix(a_extra.xy, a_extra.zw, corner * 0.5 + 0.5);
+    v_color = a_color;
+    v_kind = a_kind;
+    v_params = a_extra.xy;
+    gl_Position = u_view_projection * vec4(position, 0.0, 1.0);
+}
+)";
+
+        constexpr const char *kFragmentShader = R"(#version 430 core
+in vec2 v_local;
+in vec2 v_uv;
+in vec4 v_color;
+flat in uint v_kind;
+flat in vec2 v_params;
+
+uniform sampler2D u_textures[16];
+
+out vec4 o_color;
+
+// Constant indices only: a per-instance index into a sampler array is not
+// dynamically uniform, which GLSL leaves undefined
+vec4 SampleSlot(uint slot, vec2 uv)
+{
+    switch (slot)
+    {
+    case 0u: return texture(u_textures[0], uv);
+    case 1u: return texture(u_textures[1], uv);
+    case 2u: return texture(u_textures[2], uv);
+    case 3u: return texture(u_textures[3], uv);
+    case 4u: return texture(u_textures[4], uv);
+    case 5u: return texture(u_textures[5], uv);
+    case 6u: return texture(u_textures[6], uv);
+    case 7u: return texture(u_textures[7], uv);
+    case 8u: return texture(u_textures[8], uv);
+    case 9u: return texture(u_textures[9], uv);
+    case 10u: return texture(u_textures[10], uv);
+    case 11u: return texture(u_textures[11], uv);
+    case 12u: return texture(u_textures[12], uv);
+    case 13u: return texture(u_textures[13], uv);
+    case 14u: return texture(u_textures[14], uv);
+    case 15u: return texture(u_textures[15], uv);
+    }
+    return vec4(1.0);
+}
+
+void main()
+{
+    uint kind = v_kind & 3u;
+    vec4 color = v_color;
+    if (kind == 0u)
+    {
+        uint slot = v_kind >> 2;
+        if (slot != 0u)
+        {
+            color *= SampleSlot(slot - 1u, v_uv);
+        }
+    }
+    else if (kind == 2u)
+    {
+        float edge = 1.0 - length(v_local);
+        // Outer edge fades in, the inner edge of a ring fades out
+        float alpha = smoothstep(0.0, v_params.y, edge) *
+                      (1.0 - smoothstep(v_params.x, v_params.x + v_params.y, edge));
+        if (alpha <= 0.0)
+        {
+            discard;
+        }
+        color.a *= alpha;
+    }
+    o_color = color;
+}
+)";
+
+        GLuint CompileShader(GLenum type, const char *source)
+        {
+            GLuint shader = glCreateShader(type);
+            glShaderSource(shader, 1, &source, nullptr);
+            glCompileShader(shader);
+
+            GLint compiled = GL_FALSE;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+            if (!compiled)
+            {
+                char log[1024] = {};
+                glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+                std::fprintf(stderr, "[Flux] Renderer2D shader failed to compile: %s\n", log);
+                glDeleteShader(shader);
+                return 0;
+            }
+            return shader;
+        }
+
+        size_t AlignUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    } // namespace
+
+    bool Renderer2D::Init()
+    {
+        const GLuint vertex_shader = CompileShader(GL_VERTEX_SHADER, kVertexShader);
+        const GLuint fragment_shader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+        if (!vertex_shader || !fragment_shader)
+        {
+            glDeleteShader(vertex_shader);
+            glDeleteShader(fragment_shader);
+            return false;
+        }
+
+        program_ = glCreateProgram();
+        glAttachShader(program_, vertex_shader);
+        glAttachShader(program_, fragment_shader);
+        glLinkProgram(program_);
+        glDeleteShader(vertex_shader);
+        glDeleteShader(fragment_shader);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program_, GL_LINK_STATUS, &linked);
+        if (!linked)
+        {
+            char log[1024] = {};
+            glGetProgramInfoLog(program_, sizeof(log), nullptr, log);
+            std::fprintf(stderr, "[Flux] Renderer2D program failed to link: %s\n", log);
+            glDeleteProgram(program_);
+            program_ = 0;
+            return false;
+        }
+
+        view_projection_location_ = glGetUniformLocation(program_, "u_view_projection");
+        GLint slots[kMaxTextureSlots];
+        for (uint32_t i = 0; i < kMaxTextureSlots; ++i)
+        {
+            slots[i] = static_cast<GLint>(i);
+        }
+        glUseProgram(program_);
+        glUniform1iv(glGetUniformLocation(program_, "u_textures"), kMaxTextureSlots, slots);
+        glUseProgram(0);
+
+        // One binding per attribute, each a separate stream with divisor 1; the
+        // buffers are bound per batch with glBindVertexBuffer
+        glGenVertexArrays(1, &vertex_array_);
+        glBindVertexArray(vertex_array_);
+        for (GLuint attribute = 0; attribute < 5; ++attribute)
+        {
+            glEnableVertexAttribArray(attribute);
+            glVertexAttribBinding(attribute, attribute);
+            glVertexBindingDivisor(attribute, 1);
+        }
+        glVertexAttribFormat(0, 4, GL_FLOAT, GL_FALSE, 0);
+        glVertexAttribFormat(1, 4, GL_FLOAT, GL_FALSE, 0);
+        glVertexAttribFormat(2, 1, GL_FLOAT, GL_FALSE, 0);
+        glVertexAttribFormat(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0);
+        glVertexAttribIFormat(4, 1, GL_UNSIGNED_INT, 0);
+        glBindVertexArray(0);
+
+        if (!CreateRing(std::max<size_t>(config_.segment_bytes, kInstanceBytes * 1024)))
+        {
+            Shutdown();
+            return false;
+        }
+        return true;
+    }
+
+    bool Renderer2D::CreateRing(size_t segment_bytes)
+    {
+        segment_bytes_ = AlignUp(segment_bytes, kStreamAlignment);
+        const GLsizeiptr size = static_cast<GLsizeiptr>(segment_bytes_ * kRingSegments);
+
+        glGenBuffers(1, &ring_buffer_);
+        glBindBuffer(GL_ARRAY_BUFFER, ring_buffer_);
+        // Persistent mapping needs glBufferStorage (GL 4.4), otherwise batches go
+        // through glBufferSubData into the same segments
+        if (GLAD_GL_VERSION_4_4)
+        {
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+            ring_memory_ = static_cast<uint8_t *>(glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+        }
+        if (!ring_memory_)
+        {
+            if (GLAD_GL_VERSION_4_4)
+            {
+                // Immutable storage cannot be respecified, start over
+                glDeleteBuffers(1, &ring_buffer_);
+                glGenBuffers(1, &ring_buffer_);
+                glBindBuffer(GL_ARRAY_BUFFER, ring_buffer_);
+            }
+            glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        batch_capacity_ = static_cast<uint32_t>(std::min<size_t>(
+            config_.max_batch_instances, (segment_bytes_ - kInstanceBytes) / kInstanceBytes));
+        batch_capacity_ = std::max<uint32_t>(batch_capacity_, 1);
+        shapes_.resize(batch_capacity_);
+        extras_.resize(batch_capacity_);
+        rotations_.resize(batch_capacity_);
+        colors_.resize(batch_capacity_);
+        kinds_.resize(batch_capacity_);
+
+        segment_index_ = 0;
+        segment_offset_ = 0;
+        return ring_buffer_ != 0;
+    }
+
+    void Renderer2D::DestroyRing()
+    {
+        for (size_t segment = 0; segment < kRingSegments; ++segment)
+        {
+            WaitForSegment(segment);
+        }
+
+        if (ring_buffer_)
+        {
+            if (ring_memory_)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, ring_buffer_);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+                glBindBuffer(GL_ARRAY_BUFFER, 0);
+            }
+            glDeleteBuffers(1, &ring_buffer_);
+        }
+        ring_buffer_ = 0;
+        ring_memory_ = nullptr;
+        segment_bytes_ = 0;
+    }
+
+    void Renderer2D::Shutdown()
+    {
+        DestroyRing();
+        if (vertex_array_)
+        {
+            glDeleteVertexArrays(1, &vertex_array_);
+            vertex_array_ = 0;
+        }
+        if (program_)
+        {
+            glDeleteProgram(program_);
+            program_ = 0;
+        }
+        initialized_ = false;
+        in_scene_ = false;
+    }
+
+    void Renderer2D::WaitForSegment(size_t segment)
+    {
+        void *&fence = segment_fences_[segment];
+        if (fence)
+        {
+            glClientWaitSync(static_cast<GLsync>(fence), GL_SYNC_FLUSH_COMMANDS_BIT,
+                             1000000000ull);
+            glDeleteSync(static_cast<GLsync>(fence));
+            fence = nullptr;
+        }
+    }
+
+    void Renderer2D::AdvanceSegment()
+    {
+        segment_fences_[segment_index_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        segment_index_ = (segment_index_ + 1) % kRingSegments;
+        segment_offset_ = 0;
+        // Written kRingSegments frames ago unless this frame already wrapped
+        WaitForSegment(segment_index_);
+    }
+
+    void Renderer2D::BeginScene(const glm::mat4 &view_projection)
+    {
+        if (!initialized_ && !init_failed_)
+        {
+            initialized_ = Init();
+            init_failed_ = !initialized_;
+        }
+        if (!initialized_)
+        {
+            return;
+        }
+
+        blend_was_enabled_ = glIsEnabled(GL_BLEND);
+        depth_was_enabled_ = glIsEnabled(GL_DEPTH_TEST);
+        cull_was_enabled_ = glIsEnabled(GL_CULL_FACE);
+        glEnable(GL_BLEND);
+        glBlendEquation(GL_FUNC_ADD);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE,
+                            GL_ONE_MINUS_SRC_ALPHA);
+        glDisable(GL_DEPTH_TEST);
+        glDisable(GL_CULL_FACE);
+
+        glUseProgram(program_);
+        glUniformMatrix4fv(view_projection_location_, 1, GL_FALSE,
+                           glm::value_ptr(view_projection));
+        in_scene_ = true;
+    }
+
+    void Renderer2D::EndScene()
+    {
+        if (!in_scene_)
+        {
+            return;
+        }
+
+        Flush();
+        in_scene_ = false;
+
+        glBindVertexArray(0);
+        glUseProgram(0);
+        glActiveTexture(GL_TEXTURE0);
+        blend_was_enabled_ ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+        depth_was_enabled_ ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+        cull_was_enabled_ ? glEnable(GL_CULL_FACE) : glDisable(GL_CULL_FACE);
+    }
+
+    void Renderer2D::Flush()
+    {
+        const uint32_t count = batch_count_;
+        if (count == 0)
+        {
+            return;
+        }
+
+        const size_t bytes = kInstanceBytes * count;
+        if (segment_offset_ + bytes > segment_bytes_)
+        {
+            AdvanceSegment();
+            ++frame_stats_.segment_waits;
+        }
+
+        // Streams back to back: shapes, extras, rotations, colors, kinds
+        const size_t base = segment_index_ * segment_bytes_ + segment_offset_;
+        const size_t offsets[5] = {base, base + 16 * count, base + 32 * count,
+                                   base + 36 * count, base + 40 * count};
+        const void *sources[5] = {shapes_.data(), extras_.data(), rotations_.data(),
+                                  colors_.data(), kinds_.data()};
+        const size_t sizes[5] = {16 * count, 16 * count, 4 * count, 4 * count, 4 * count};
+        const GLsizei strides[5] = {16, 16, 4, 4, 4};
+
+        if (ring_memory_)
+        {
+            for (size_t stream = 0; stream < 5; ++stream)
+            {
+                std::memcpy(ring_memory_ + offsets[stream], sources[stream], sizes[stream]);
+            }
+        }
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, ring_buffer_);
+            for (size_t stream = 0; stream < 5; ++stream)
+            {
+                glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(offsets[stream]),
+                                static_cast<GLsizeiptr>(sizes[stream]), sources[stream]);
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+
+        // Layers may have used their own GL state since the last batch
+        glUseProgram(program_);
+        glBindVertexArray(vertex_array_);
+        for (GLuint stream = 0; stream < 5; ++stream)
+        {
+            glBindVertexBuffer(stream, ring_buffer_, static_cast<GLintptr>(offsets[stream]),
+                               strides[stream]);
+        }
+        for (uint32_t slot = 0; slot < texture_slot_count_; ++slot)
+        {
+            glActiveTexture(GL_TEXTURE0 + slot);
+            glBindTexture(GL_TEXTURE_2D, texture_slots_[slot]);
+        }
+
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(count));
+
+        segment_offset_ = AlignUp(segment_offset_ + bytes, kStreamAlignment);
+        frame_bytes_ += bytes;
+        ++frame_stats_.draw_calls;
+        frame_stats_.vertices += 4ull * count;
+        frame_stats_.uploaded_bytes += bytes;
+
+        batch_count_ = 0;
+        texture_slot_count_ = 0;
+    }
+
+    void Renderer2D::EndFrame()
+    {
+        stats_ = frame_stats_;
+        stats_.persistent_mapping = ring_memory_ != nullptr;
+        const bool outgrown = frame_stats_.segment_waits > 0;
+        frame_stats_ = Renderer2DStats();
+
+        if (!initialized_)
+        {
+            return;
+        }
+
+        EndScene();
+        if (segment_offset_ > 0)
+        {
+            AdvanceSegment();
+        }
+
+        // A frame that wrapped the ring waited on its own batches; give the next one
+        // a segment that holds it with room to spare
+        if (outgrown)
+        {
+            const size_t segment_bytes = frame_bytes_ + frame_bytes_ / 2;
+            DestroyRing();
+            if (!CreateRing(segment_bytes))
+            {
+                Shutdown();
+                init_failed_ = true;
+            }
+        }
+        frame_bytes_ = 0;
+    }
+
+    uint32_t Renderer2D::GetTextureSlot(uint32_t texture_id)
+    {
+        for (uint32_t slot = 0; slot < texture_slot_count_; ++slot)
+        {
+            if (texture_slots_[slot] == texture_id)
+            {
+                return slot;
+            }
+        }
+
+        if (texture_slot_count_ == kMaxTextureSlots)
+        {
+            Flush();
+        }
+        // Once per texture and batch instead of once per quad
+        if (texture_manager_)
+        {
+            texture_manager_->MarkUsed(texture_id);
+        }
+        texture_slots_[texture_slot_count_] = texture_id;
+        return texture_slot_count_++;
+    }
+
+    void Renderer2D::Push(const glm::vec4 &shape, const glm::vec4 &extra, float rotation,
+                          uint32_t color, uint32_t kind)
+    {
+        if (batch_count_ == batch_capacity_)
+        {
+            Flush();
+        }
+        const uint32_t index = batch_count_++;
+        shapes_[index] = shape;
+        extras_[index] = extra;
+        rotations_[index] = rotation;
+        colors_[index] = color;
+        kinds_[index] = kind;
+    }
+
+    void Renderer2D::DrawQuad(const glm::vec2 &center, const glm::vec2 &size, uint32_t color,
+                              float rotation)
+    {
+        if (!in_scene_)
+        {
+            return;
+        }
+        Push(glm::vec4(center.x, center.y, size.x * 0.5f, size.y * 0.5f), glm::vec4(0.0f),
+             rotation, color, ShapeQuad);
+        ++frame_stats_.quads;
+    }
+
+    void Renderer2D::DrawQuad(const glm::vec2 &center, const glm::vec2 &size, uint32_t texture_id,
+                              uint32_t color, float rotation, const glm::vec4 &uv_rect)
+    {
+        if (!in_scene_)
+        {
+            return;
+        }
+        if (texture_id == 0)
+        {
+            DrawQuad(center, size, color, rotation);
+            return;
+        }
+
+        // A full batch flushes before the slot is taken, so the slot stays valid
+        if (batch_count_ == batch_capacity_)
+        {
+            Flush();
+        }
+        const uint32_t slot = GetTextureSlot(texture_id);
+        Push(glm::vec4(center.x, center.y, size.x * 0.5f, size.y * 0.5f), uv_rect, rotation,
+             color, ShapeQuad | ((slot + 1) << 2));
+        ++frame_stats_.quads;
+    }
+
+    void Renderer2D::DrawSprite(const Texture &texture, const glm::vec2 &center,
+                                const glm::vec2 &size, uint32_t color, float rotation)
+    {
+        // Through the ImTextureID so an evicted texture is reloaded like in ImGui
+        const auto texture_id = static_cast<uint32_t>((intptr_t)texture.GetImTextureID());
+        DrawQuad(center, size, texture_id, color, rotation);
+    }
+
+    void Renderer2D::DrawLine(const glm::vec2 &from, const glm::vec2 &to, uint32_t color,
+                              float thickness)
+    {
+        if (!in_scene_)
+        {
+            return;
+        }
+        Push(glm::vec4(from.x, from.y, to.x, to.y), glm::vec4(thickness, 0.0f, 0.0f, 0.0f),
+             0.0f, color, ShapeLine);
+        ++frame_stats_.lines;
+    }
+
+    void Renderer2D::DrawCircle(const glm::vec2 &center, float radius, uint32_t color,
+                                float thickness, float fade)
+    {
+        if (!in_scene_)
+        {
+            return;
+        }
+        Push(glm::vec4(center.x, center.y, radius, 0.0f),
+             glm::vec4(thickness, std::max(fade, 1e-4f), 0.0f, 0.0f), 0.0f, color, ShapeCircle);
+        ++frame_stats_.circles;
+    }
+
+} // namespace flux
@@ -0,0 +1,169 @@
+// Copyright 2026 Beisent
+// Batched immediate-mode 2D renderer for Flux framework
+
+#ifndef FLUX_CORE_SRC_RENDERER2D_HPP_
+#define FLUX_CORE_SRC_RENDERER2D_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Texture.hpp"
+
+namespace flux
+{
+
+    class TextureManager;
+
+    struct Renderer2DConfig
+    {
+        // Initial size of each of the kRingSegments buffer segments. A frame that
+        // spills over makes the next frame start with segments large enough for it.
+        size_t segment_bytes = 4 * 1024 * 1024;
+        uint32_t max_batch_instances = 65536;
+    };
+
+    struct Renderer2DStats
+    {
+        uint32_t draw_calls = 0;
+        uint32_t quads = 0;
+        uint32_t lines = 0;
+        uint32_t circles = 0;
+        uint64_t vertices = 0; // Four per primitive, generated in the vertex shader
+        uint64_t uploaded_bytes = 0;
+        uint32_t segment_waits = 0; // Times a frame outran its ring segment
+        bool persistent_mapping = false;
+    };
+
+    // Every primitive is one instance of a four-vertex strip, so quads, lines and
+    // circles share a single shader and batch, and submission order is draw order.
+    // Instances are staged structure-of-arrays on the CPU and copied stream by
+    // stream into a ring buffer split in kRingSegments fenced segments, persistently
+    // mapped when GL 4.4 buffer storage is available. A batch ends when it is full,
+    // when it needs a 17th texture, or at EndScene().
+    //
+    // Layers draw from OnUpdate or OnRenderUI on the GL thread, into the window or a
+    // RenderTarget:
+    //
+    //     Renderer2D &renderer = Application::Get().GetRenderer2D();
+    //     renderer.BeginScene(glm::ortho(0.0f, width, height, 0.0f, -1.0f, 1.0f));
+    //     renderer.DrawQuad({x, y}, {w, h}, IM_COL32(255, 128, 0, 255));
+    //     renderer.DrawLine({x0, y0}, {x1, y1}, IM_COL32_WHITE, 2.0f);
+    //     renderer.EndScene();
+    //
+    // Colors are packed like IM_COL32.
+    class Renderer2D
+    {
+    public:
+        static constexpr size_t kRingSegments = 3;
+        static constexpr uint32_t kMaxTextureSlots = 16;
+
+        Renderer2D() = default;
+        ~Renderer2D() = default;
+
+        Renderer2D(const Renderer2D &) = delete;
+        Renderer2D &operator=(const Renderer2D &) = delete;
+
+        // Nothing is created on the GPU until the first BeginScene()
+        void SetConfig(const Renderer2DConfig &config) { config_ = config; }
+        // Textures drawn here count as used for its eviction
+        void SetTextureManager(TextureManager *texture_manager)
+        {
+            texture_manager_ = texture_manager;
+        }
+        void Shutdown();
+
+        void BeginScene(const glm::mat4 &view_projection);
+        void EndScene();
+        // Draws what is staged, the scene stays open
+        void Flush();
+
+        void DrawQuad(const glm::vec2 &center, const glm::vec2 &size, uint32_t color,
+                      float rotation = 0.0f);
+        // uv_rect = (u0, v0, u1, v1)
+        void DrawQuad(const glm::vec2 &center, const glm::vec2 &size, uint32_t texture_id,
+                      uint32_t color, float rotation = 0.0f,
+                      const glm::vec4 &uv_rect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+        // Draws the manager's placeholder while the texture is loading
+        void DrawSprite(const Texture &texture, const glm::vec2 &center, const glm::vec2 &size,
+                        uint32_t color = 0xFFFFFFFF, float rotation = 0.0f);
+        void DrawLine(const glm::vec2 &from, const glm::vec2 &to, uint32_t color,
+                      float thickness = 1.0f);
+        // thickness is a fraction of the radius, 1 fills the circle; fade softens the
+        // edge, also as a fraction of the radius
+        void DrawCircle(const glm::vec2 &center, float radius, uint32_t color,
+                        float thickness = 1.0f, float fade = 0.01f);
+
+        // Called by the application once per frame, rotates the ring
+        void EndFrame();
+
+        [[nodiscard]] bool IsInScene() const { return in_scene_; }
+        // Anything drawn since the last EndFrame()
+        [[nodiscard]] bool HasDrawnThisFrame() const { return frame_stats_.draw_calls > 0; }
+        // Totals of the previous frame
+        [[nodiscard]] const Renderer2DStats &GetStats() const { return stats_; }
+
+    private:
+        enum ShapeKind : uint32_t
+        {
+            ShapeQuad = 0,
+            ShapeLine = 1,
+            ShapeCircle = 2
+        };
+
+        bool Init();
+        bool CreateRing(size_t segment_bytes);
+        void DestroyRing();
+        void WaitForSegment(size_t segment);
+        void AdvanceSegment();
+        [[nodiscard]] uint32_t GetTextureSlot(uint32_t texture_id);
+        void Push(const glm::vec4 &shape, const glm::vec4 &extra, float rotation,
+                  uint32_t color, uint32_t kind);
+
+        Renderer2DConfig config_;
+        TextureManager *texture_manager_ = nullptr;
+        bool initialized_ = false;
+        bool init_failed_ = false;
+        bool in_scene_ = false;
+
+        uint32_t program_ = 0;
+        uint32_t vertex_array_ = 0;
+        int view_projection_location_ = -1;
+
+        // Ring: kRingSegments segments of segment_bytes_, one fence each
+        uint32_t ring_buffer_ = 0;
+        uint8_t *ring_memory_ = nullptr; // Null without persistent mapping
+        size_t segment_bytes_ = 0;
+        size_t segment_index_ = 0;
+        size_t segment_offset_ = 0;
+        std::array<void *, kRingSegments> segment_fences_{};
+        size_t frame_bytes_ = 0;
+        size_t grow_to_bytes_ = 0;
+
+        // Structure-of-arrays staging, one stream per vertex attribute
+        uint32_t batch_capacity_ = 0;
+        uint32_t batch_count_ = 0;
+        std::vector<glm::vec4> shapes_;
+        std::vector<glm::vec4> extras_;
+        std::vector<float> rotations_;
+        std::vector<uint32_t> colors_;
+        std::vector<uint32_t> kinds_; // ShapeKind | (texture slot + 1) << 2
+
+        std::array<uint32_t, kMaxTextureSlots> texture_slots_{};
+        uint32_t texture_slot_count_ = 0;
+
+        // Restored by EndScene()
+        bool blend_was_enabled_ = false;
+        bool depth_was_enabled_ = false;
+        bool cull_was_enabled_ = false;
+
+        Renderer2DStats frame_stats_;
+        Renderer2DStats stats_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_RENDERER2D_HPP_
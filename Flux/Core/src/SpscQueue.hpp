@@ -0,0 +1,59 @@
+// Copyright 2026 Beisent
+// Lock-free single-producer single-consumer ring queue
+
+#ifndef FLUX_CORE_SRC_SPSCQUEUE_HPP_
+#define FLUX_CORE_SRC_SPSCQUEUE_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace flux
+{
+
+    // Fixed capacity, no allocation. One thread pushes, one thread pops.
+    template <typename T, size_t Capacity>
+    class SpscQueue
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        bool TryPush(const T &value)
+        {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            if (head - tail_.load(std::memory_order_acquire) == Capacity)
+            {
+                return false;
+            }
+            slots_[head & (Capacity - 1)] = value;
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPop(T &out)
+        {
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail == head_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            out = std::move(slots_[tail & (Capacity - 1)]);
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::array<T, Capacity> slots_{};
+        alignas(64) std::atomic<size_t> head_{0};
+        alignas(64) std::atomic<size_t> tail_{0};
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_SPSCQUEUE_HPP_
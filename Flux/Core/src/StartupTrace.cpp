@@ -0,0 +1,117 @@
+// Copyright 2026 Beisent
+// StartupTrace implementation
+
+#include "StartupTrace.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace flux
+{
+
+    namespace
+    {
+        void WriteEscaped(std::FILE *file, const std::string &text)
+        {
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    std::fputc('\\', file);
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    continue;
+                }
+                std::fputc(c, file);
+            }
+        }
+    } // namespace
+
+    StartupTrace::StartupTrace() : origin_(Clock::now())
+    {
+        threads_.push_back(std::this_thread::get_id());
+    }
+
+    uint32_t StartupTrace::GetThreadIndex(std::thread::id thread)
+    {
+        auto it = std::find(threads_.begin(), threads_.end(), thread);
+        if (it == threads_.end())
+        {
+            threads_.push_back(thread);
+            return static_cast<uint32_t>(threads_.size() - 1);
+        }
+        return static_cast<uint32_t>(it - threads_.begin());
+    }
+
+    void StartupTrace::Record(std::string_view name, Clock::time_point begin,
+                              Clock::time_point end)
+    {
+        if (IsFinished())
+        {
+            return;
+        }
+
+        Span span;
+        span.name = std::string(name);
+        span.begin_us = std::chrono::duration<double, std::micro>(begin - origin_).count();
+        span.duration_us = std::chrono::duration<double, std::micro>(end - begin).count();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        span.thread = GetThreadIndex(std::this_thread::get_id());
+        spans_.push_back(std::move(span));
+    }
+
+    void StartupTrace::Mark(std::string_view name)
+    {
+        const Clock::time_point now = Clock::now();
+        Record(name, now, now);
+    }
+
+    std::vector<StartupTrace::Span> StartupTrace::GetSpans() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return spans_;
+    }
+
+    bool StartupTrace::WriteChromeTrace(const std::string &path) const
+    {
+        std::FILE *file = std::fopen(path.c_str(), "w");
+        if (!file)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+        for (size_t i = 0; i < threads_.size(); ++i)
+        {
+            std::fprintf(file,
+                         "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,"
+                         "\"args\":{\"name\":\"%s %zu\"}},\n",
+                         i, i == 0 ? "Main" : "Worker", i);
+        }
+
+        for (size_t i = 0; i < spans_.size(); ++i)
+        {
+            const Span &span = spans_[i];
+            std::fputs("{\"name\":\"", file);
+            WriteEscaped(file, span.name);
+            if (span.duration_us > 0.0)
+            {
+                std::fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                             span.thread, span.begin_us, span.duration_us);
+            }
+            else
+            {
+                std::fprintf(file, "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+                             span.thread, span.begin_us);
+            }
+            std::fputs(i + 1 < spans_.size() ? ",\n" : "\n", file);
+        }
+        std::fputs("]}\n", file);
+
+        return std::fclose(file) == 0;
+    }
+
+} // namespace flux
@@ -0,0 +1,81 @@
+// Copyright 2026 Beisent
+// Startup phase timeline for Flux framework
+
+#ifndef FLUX_CORE_SRC_STARTUPTRACE_HPP_
+#define FLUX_CORE_SRC_STARTUPTRACE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace flux
+{
+
+    // Records init phases from any thread, relative to the application's creation,
+    // until Finish(). Written as Chrome trace event JSON (chrome://tracing, Perfetto).
+    class StartupTrace
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct Span
+        {
+            std::string name;
+            uint32_t thread = 0; // 0 = the thread that created the trace
+            double begin_us = 0.0;
+            double duration_us = 0.0; // 0 for instant markers
+        };
+
+        StartupTrace();
+
+        void Record(std::string_view name, Clock::time_point begin, Clock::time_point end);
+        void Mark(std::string_view name);
+        void Finish() { finished_.store(true, std::memory_order_release); }
+
+        [[nodiscard]] bool IsFinished() const { return finished_.load(std::memory_order_acquire); }
+        [[nodiscard]] double GetElapsedMilliseconds(Clock::time_point time) const
+        {
+            return std::chrono::duration<double, std::milli>(time - origin_).count();
+        }
+        [[nodiscard]] std::vector<Span> GetSpans() const;
+
+        bool WriteChromeTrace(const std::string &path) const;
+
+    private:
+        uint32_t GetThreadIndex(std::thread::id thread);
+
+        Clock::time_point origin_;
+        std::atomic<bool> finished_{false};
+
+        mutable std::mutex mutex_;
+        std::vector<Span> spans_;
+        std::vector<std::thread::id> threads_;
+    };
+
+    class StartupTraceScope
+    {
+    public:
+        StartupTraceScope(StartupTrace &trace, std::string name)
+            : trace_(trace), name_(std::move(name)), begin_(StartupTrace::Clock::now())
+        {
+        }
+
+        ~StartupTraceScope() { trace_.Record(name_, begin_, StartupTrace::Clock::now()); }
+
+        StartupTraceScope(const StartupTraceScope &) = delete;
+        StartupTraceScope &operator=(const StartupTraceScope &) = delete;
+
+    private:
+        StartupTrace &trace_;
+        std::string name_;
+        StartupTrace::Clock::time_point begin_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_STARTUPTRACE_HPP_
@@ -0,0 +1,82 @@
+// Copyright 2026 Beisent
+// Texture handle for Flux framework
+
+#ifndef FLUX_CORE_SRC_TEXTURE_HPP_
+#define FLUX_CORE_SRC_TEXTURE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <imgui.h>
+
+namespace flux
+{
+
+    enum class TextureState : uint8_t
+    {
+        Loading,
+        Ready,
+        Failed,
+        Evicted // Dropped from the GPU cache, reloads when drawn again
+    };
+
+    // Returned by TextureManager::Load. Until the pixels are on the GPU the handle
+    // draws the manager's placeholder, so it can be passed to ImGui::Image right away.
+    // The same holds after a cache eviction, asking for the ImTextureID reloads it.
+    // Query it from the main thread only.
+    class Texture
+    {
+    public:
+        explicit Texture(std::string path) : path_(std::move(path)) {}
+
+        Texture(const Texture &) = delete;
+        Texture &operator=(const Texture &) = delete;
+
+        [[nodiscard]] const std::string &GetPath() const { return path_; }
+        [[nodiscard]] TextureState GetState() const { return Resolve().state_; }
+        [[nodiscard]] bool IsReady() const { return GetState() == TextureState::Ready; }
+
+        // 0 while loading
+        [[nodiscard]] uint32_t GetRendererID() const
+        {
+            return IsReady() ? Resolve().renderer_id_ : 0;
+        }
+        [[nodiscard]] uint32_t GetWidth() const { return Resolve().width_; }
+        [[nodiscard]] uint32_t GetHeight() const { return Resolve().height_; }
+        [[nodiscard]] uint64_t GetContentHash() const { return Resolve().content_hash_; }
+
+        [[nodiscard]] ImTextureID GetImTextureID() const
+        {
+            const Texture &resolved = Resolve();
+            if (resolved.state_ == TextureState::Evicted)
+            {
+                resolved.reload_requested_ = true;
+            }
+            const uint32_t id = IsReady() ? resolved.renderer_id_ : placeholder_id_;
+            return (ImTextureID)(intptr_t)id;
+        }
+
+    private:
+        friend class TextureManager;
+
+        // Files with identical content share the texture that was decoded first
+        [[nodiscard]] const Texture &Resolve() const { return alias_ ? *alias_ : *this; }
+
+        std::string path_;
+        TextureState state_ = TextureState::Loading;
+        uint32_t renderer_id_ = 0;
+        uint32_t placeholder_id_ = 0;
+        uint32_t width_ = 0;
+        uint32_t height_ = 0;
+        uint64_t content_hash_ = 0;
+        std::shared_ptr<Texture> alias_;
+        mutable bool reload_requested_ = false;
+    };
+
+    using TextureHandle = std::shared_ptr<Texture>;
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_TEXTURE_HPP_
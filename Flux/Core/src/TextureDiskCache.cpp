@@ -0,0 +1,177 @@
+// Copyright 2026 Beisent
+// TextureDiskCache implementation
+
+#include "TextureDiskCache.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <utility>
+
+namespace flux
+{
+
+    namespace
+    {
+        uint64_t HashPath(const std::string &path)
+        {
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for (char c : path)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 0x100000001b3ull;
+            }
+            return hash;
+        }
+    } // namespace
+
+    TextureDiskCache::TextureDiskCache(std::string directory, bool mipmaps)
+        : directory_(std::move(directory)), mipmaps_(mipmaps)
+    {
+        if (directory_.empty())
+        {
+            return;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(directory_, error);
+        if (error)
+        {
+            std::fprintf(stderr, "[Flux] Texture cache directory '%s' unavailable: %s\n",
+                         directory_.c_str(), error.message().c_str());
+            directory_.clear();
+        }
+    }
+
+    bool TextureDiskCache::QuerySource(const std::string &source_path, TextureSourceInfo &info)
+    {
+        std::error_code error;
+        const auto size = std::filesystem::file_size(source_path, error);
+        if (error)
+        {
+            return false;
+        }
+        const auto modified = std::filesystem::last_write_time(source_path, error);
+        if (error)
+        {
+            return false;
+        }
+
+        info.size = static_cast<uint64_t>(size);
+        info.modified_time = static_cast<int64_t>(modified.time_since_epoch().count());
+        return true;
+    }
+
+    std::string TextureDiskCache::GetEntryPath(const std::string &source_path) const
+    {
+        // Relative and absolute spellings of a path share one entry
+        std::error_code error;
+        std::filesystem::path absolute = std::filesystem::absolute(source_path, error);
+        const std::string key =
+            error ? source_path : absolute.lexically_normal().generic_string();
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.ftc",
+                      static_cast<unsigned long long>(HashPath(key)));
+        return (std::filesystem::path(directory_) / name).string();
+    }
+
+    bool TextureDiskCache::Load(const std::string &source_path, const TextureSourceInfo &source,
+                                TextureImage &image) const
+    {
+        if (!IsEnabled())
+        {
+            return false;
+        }
+
+        MappedFile mapping;
+        if (!mapping.Open(GetEntryPath(source_path)) || mapping.GetSize() < sizeof(Header))
+        {
+            return false;
+        }
+
+        const Header &header = *reinterpret_cast<const Header *>(mapping.GetData());
+        if (header.magic != kMagic || header.version != kVersion ||
+            header.bytes_per_pixel != TextureImage::kBytesPerPixel ||
+            header.source_size != source.size ||
+            header.source_modified_time != source.modified_time || header.width == 0 ||
+            header.height == 0)
+        {
+            return false;
+        }
+
+        const uint32_t expected_mips =
+            mipmaps_ ? TextureImage::GetFullMipCount(header.width, header.height) : 1;
+        if (header.mip_count != expected_mips)
+        {
+            return false;
+        }
+
+        TextureImage cached;
+        cached.width = header.width;
+        cached.height = header.height;
+        cached.mip_count = header.mip_count;
+        cached.content_hash = header.content_hash;
+        if (header.data_size != cached.GetByteSize() ||
+            mapping.GetSize() < sizeof(Header) + header.data_size)
+        {
+            return false;
+        }
+
+        cached.mapping = std::move(mapping);
+        cached.mapping_offset = sizeof(Header);
+        image = std::move(cached);
+        return true;
+    }
+
+    bool TextureDiskCache::Store(const std::string &source_path, const TextureSourceInfo &source,
+                                 const TextureImage &image) const
+    {
+        if (!IsEnabled() || !image.IsValid())
+        {
+            return false;
+        }
+
+        Header header{};
+        header.magic = kMagic;
+        header.version = kVersion;
+        header.width = image.width;
+        header.height = image.height;
+        header.mip_count = image.mip_count;
+        header.bytes_per_pixel = TextureImage::kBytesPerPixel;
+        header.source_size = source.size;
+        header.source_modified_time = source.modified_time;
+        header.content_hash = image.content_hash;
+        header.data_size = image.GetByteSize();
+
+        const std::string entry_path = GetEntryPath(source_path);
+        const std::string temporary_path =
+            entry_path + "." + std::to_string(std::hash<std::thread::id>()(
+                                   std::this_thread::get_id())) + ".tmp";
+        {
+            std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char *>(image.GetPixels()),
+                       static_cast<std::streamsize>(header.data_size));
+            if (!file)
+            {
+                file.close();
+                std::error_code error;
+                std::filesystem::remove(temporary_path, error);
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary_path, entry_path, error);
+        if (error)
+        {
+            std::filesystem::remove(temporary_path, error);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace flux
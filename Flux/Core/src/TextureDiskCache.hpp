@@ -0,0 +1,70 @@
+// Copyright 2026 Beisent
+// Persistent cache of decoded textures for Flux framework
+
+#ifndef FLUX_CORE_SRC_TEXTUREDISKCACHE_HPP_
+#define FLUX_CORE_SRC_TEXTUREDISKCACHE_HPP_
+
+#include <cstdint>
+#include <string>
+
+#include "TextureImage.hpp"
+
+namespace flux
+{
+
+    struct TextureSourceInfo
+    {
+        uint64_t size = 0;
+        int64_t modified_time = 0;
+    };
+
+    // Stores decoded RGBA8 mip chains in one file per source image, named after a
+    // hash of the source path. Entries are validated against the source file's size
+    // and modification time and mapped straight into memory on a hit. A stale or
+    // damaged entry is treated as a miss and overwritten by the next Store().
+    // Safe to use from several threads as long as each path is handled by one.
+    class TextureDiskCache
+    {
+    public:
+        static constexpr uint32_t kMagic = 0x43545846; // "FXTC"
+        static constexpr uint32_t kVersion = 1;
+
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t width;
+            uint32_t height;
+            uint32_t mip_count;
+            uint32_t bytes_per_pixel;
+            uint64_t source_size;
+            int64_t source_modified_time;
+            uint64_t content_hash;
+            uint64_t data_size;
+            uint64_t reserved;
+        };
+        static_assert(sizeof(Header) == 64, "Pixel data starts at a 64-byte boundary");
+
+        TextureDiskCache(std::string directory, bool mipmaps);
+
+        [[nodiscard]] bool IsEnabled() const { return !directory_.empty(); }
+
+        static bool QuerySource(const std::string &source_path, TextureSourceInfo &info);
+
+        bool Load(const std::string &source_path, const TextureSourceInfo &source,
+                  TextureImage &image) const;
+
+        // Written to a temporary file and renamed, readers never see a partial entry
+        bool Store(const std::string &source_path, const TextureSourceInfo &source,
+                   const TextureImage &image) const;
+
+    private:
+        [[nodiscard]] std::string GetEntryPath(const std::string &source_path) const;
+
+        std::string directory_;
+        bool mipmaps_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_TEXTUREDISKCACHE_HPP_
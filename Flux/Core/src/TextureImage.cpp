@@ -0,0 +1,84 @@
+// Copyright 2026 Beisent
+// TextureImage implementation
+
+#include "TextureImage.hpp"
+
+#include <cstring>
+
+namespace flux
+{
+
+    uint32_t TextureImage::GetFullMipCount(uint32_t base_width, uint32_t base_height)
+    {
+        uint32_t count = 1;
+        uint32_t extent = std::max(base_width, base_height);
+        while (extent > 1)
+        {
+            extent >>= 1;
+            ++count;
+        }
+        return count;
+    }
+
+    size_t TextureImage::GetLevelOffset(uint32_t level) const
+    {
+        size_t offset = 0;
+        for (uint32_t i = 0; i < level; ++i)
+        {
+            offset += static_cast<size_t>(GetLevelExtent(width, i)) *
+                      GetLevelExtent(height, i) * kBytesPerPixel;
+        }
+        return offset;
+    }
+
+    void TextureImage::Build(const uint8_t *rgba, uint32_t base_width, uint32_t base_height,
+                             bool mipmaps)
+    {
+        mapping.Close();
+        mapping_offset = 0;
+        width = base_width;
+        height = base_height;
+        mip_count = mipmaps ? GetFullMipCount(width, height) : 1;
+
+        storage.resize(GetByteSize());
+        std::memcpy(storage.data(), rgba,
+                    static_cast<size_t>(width) * height * kBytesPerPixel);
+
+        for (uint32_t level = 1; level < mip_count; ++level)
+        {
+            const uint32_t source_width = GetLevelExtent(width, level - 1);
+            const uint32_t source_height = GetLevelExtent(height, level - 1);
+            const uint32_t level_width = GetLevelExtent(width, level);
+            const uint32_t level_height = GetLevelExtent(height, level);
+            const uint8_t *source = storage.data() + GetLevelOffset(level - 1);
+            uint8_t *target = storage.data() + GetLevelOffset(level);
+
+            // Odd edges reuse the last texel instead of reading past the row
+            for (uint32_t y = 0; y < level_height; ++y)
+            {
+                const uint32_t y0 = std::min(y * 2, source_height - 1);
+                const uint32_t y1 = std::min(y * 2 + 1, source_height - 1);
+                for (uint32_t x = 0; x < level_width; ++x)
+                {
+                    const uint32_t x0 = std::min(x * 2, source_width - 1);
+                    const uint32_t x1 = std::min(x * 2 + 1, source_width - 1);
+                    const uint8_t *texels[4] = {
+                        source + (static_cast<size_t>(y0) * source_width + x0) * kBytesPerPixel,
+                        source + (static_cast<size_t>(y0) * source_width + x1) * kBytesPerPixel,
+                        source + (static_cast<size_t>(y1) * source_width + x0) * kBytesPerPixel,
+                        source + (static_cast<size_t>(y1) * source_width + x1) * kBytesPerPixel};
+
+                    uint8_t *out =
+                        target + (static_cast<size_t>(y) * level_width + x) * kBytesPerPixel;
+                    for (uint32_t channel = 0; channel < kBytesPerPixel; ++channel)
+                    {
+                        const uint32_t sum = texels[0][channel] + texels[1][channel] +
+                                             texels[2][channel] + texels[3][channel];
+                        out[channel] = static_cast<uint8_t>((sum + 2) / 4);
+                    }
+                }
+            }
+        }
+    }
+
+} // namespace flux
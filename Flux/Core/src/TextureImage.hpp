@@ -0,0 +1,53 @@
+// Copyright 2026 Beisent
+// CPU-side texture pixels for Flux framework
+
+#ifndef FLUX_CORE_SRC_TEXTUREIMAGE_HPP_
+#define FLUX_CORE_SRC_TEXTUREIMAGE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "MappedFile.hpp"
+
+namespace flux
+{
+
+    // RGBA8 image with its mip chain, levels stored back to back starting at level 0.
+    // The pixels live either in memory or inside a mapped disk cache entry.
+    struct TextureImage
+    {
+        static constexpr uint32_t kBytesPerPixel = 4;
+
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t mip_count = 0;
+        uint64_t content_hash = 0;
+
+        std::vector<uint8_t> storage;
+        MappedFile mapping;
+        size_t mapping_offset = 0;
+
+        // Copies level 0 and box-filters every further level from the previous one
+        void Build(const uint8_t *rgba, uint32_t base_width, uint32_t base_height,
+                   bool mipmaps);
+
+        [[nodiscard]] bool IsValid() const { return width > 0 && height > 0 && mip_count > 0; }
+        [[nodiscard]] const uint8_t *GetPixels() const
+        {
+            return mapping.IsOpen() ? mapping.GetData() + mapping_offset : storage.data();
+        }
+        [[nodiscard]] size_t GetLevelOffset(uint32_t level) const;
+        [[nodiscard]] size_t GetByteSize() const { return GetLevelOffset(mip_count); }
+
+        [[nodiscard]] static uint32_t GetLevelExtent(uint32_t extent, uint32_t level)
+        {
+            return std::max(extent >> level, 1u);
+        }
+        [[nodiscard]] static uint32_t GetFullMipCount(uint32_t base_width, uint32_t base_height);
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_TEXTUREIMAGE_HPP_
@@ -0,0 +1,591 @@
+// Copyright 2026 Beisent
+// TextureManager implementation
+
+#include "TextureManager.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <glad/glad.h>
+#include <stb_image.h>
+
+namespace flux
+{
+
+    namespace
+    {
+        constexpr uint32_t kBytesPerPixel = TextureImage::kBytesPerPixel;
+
+        bool ReadFile(const std::string &path, std::vector<uint8_t> &out)
+        {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file)
+            {
+                return false;
+            }
+
+            const std::streamsize size = file.tellg();
+            if (size <= 0)
+            {
+                return false;
+            }
+
+            out.resize(static_cast<size_t>(size));
+            file.seekg(0);
+            return static_cast<bool>(
+                file.read(reinterpret_cast<char *>(out.data()), size));
+        }
+
+        // FNV-1a, only used to detect identical files
+        uint64_t HashBytes(const std::vector<uint8_t> &bytes)
+        {
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for (uint8_t byte : bytes)
+            {
+                hash ^= byte;
+                hash *= 0x100000001b3ull;
+            }
+            return hash;
+        }
+    } // namespace
+
+    TextureManager::TextureManager(JobSystem &job_system) : job_system_(job_system) {}
+
+    TextureManager::~TextureManager() { Shutdown(); }
+
+    void TextureManager::Init(const TextureManagerConfig &config)
+    {
+        config_ = config;
+        config_.upload_budget_bytes = std::max<size_t>(config.upload_budget_bytes, 64 * 1024);
+        stats_.cache_budget_bytes = config_.cache_budget_bytes;
+        if (!config_.disk_cache_directory.empty())
+        {
+            disk_cache_ =
+                std::make_unique<TextureDiskCache>(config_.disk_cache_directory, config_.mipmaps);
+        }
+
+        // Grey checkerboard shown while an image is still loading
+        const uint8_t placeholder[2 * 2 * kBytesPerPixel] = {
+            96, 96, 96, 255, 160, 160, 160, 255, 160, 160, 160, 255, 96, 96, 96, 255};
+        GLuint placeholder_id = 0;
+        glGenTextures(1, &placeholder_id);
+        glBindTexture(GL_TEXTURE_2D, placeholder_id);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     placeholder);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        placeholder_id_ = placeholder_id;
+
+        CreateStagingBuffer();
+    }
+
+    void TextureManager::CreateStagingBuffer()
+    {
+        // Persistent mapping needs glBufferStorage (GL 4.4), otherwise rows are handed
+        // to the driver from client memory, still within the budget
+        if (!GLAD_GL_VERSION_4_4)
+        {
+            return;
+        }
+
+        segment_size_ = config_.upload_budget_bytes;
+        const GLsizeiptr size = static_cast<GLsizeiptr>(segment_size_ * kStagingSegments);
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        GLuint buffer = 0;
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, nullptr, flags);
+        void *memory = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        if (!memory)
+        {
+            glDeleteBuffers(1, &buffer);
+            segment_size_ = 0;
+            return;
+        }
+
+        staging_buffer_ = buffer;
+        staging_memory_ = static_cast<uint8_t *>(memory);
+        stats_.persistent_staging = true;
+    }
+
+    void TextureManager::Shutdown()
+    {
+        // Decode jobs reference this manager
+        job_system_.Wait(decode_jobs_);
+        decoded_.clear();
+        accepted_.clear();
+        uploads_.clear();
+
+        for (auto &[path, texture] : textures_)
+        {
+            DestroyTexture(*texture);
+            texture->placeholder_id_ = 0;
+        }
+        textures_.clear();
+        by_content_.clear();
+        resident_.clear();
+        lru_.clear();
+        evicted_count_ = 0;
+        stats_.resident_bytes = 0;
+
+        for (void *&fence : segment_fences_)
+        {
+            if (fence)
+            {
+                glDeleteSync(static_cast<GLsync>(fence));
+                fence = nullptr;
+            }
+        }
+
+        if (staging_buffer_)
+        {
+            GLuint buffer = staging_buffer_;
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            glDeleteBuffers(1, &buffer);
+            staging_buffer_ = 0;
+            staging_memory_ = nullptr;
+        }
+
+        if (placeholder_id_)
+        {
+            GLuint placeholder_id = placeholder_id_;
+            glDeleteTextures(1, &placeholder_id);
+            placeholder_id_ = 0;
+        }
+    }
+
+    TextureHandle TextureManager::Load(const std::string &path)
+    {
+        auto it = textures_.find(path);
+        if (it != textures_.end())
+        {
+            const Texture &resolved = it->second->Resolve();
+            if (resolved.state_ == TextureState::Evicted)
+            {
+                resolved.reload_requested_ = true;
+            }
+            else
+            {
+                ++stats_.cache_hits;
+            }
+            return it->second;
+        }
+
+        auto texture = std::make_shared<Texture>(path);
+        texture->placeholder_id_ = placeholder_id_;
+        textures_.emplace(path, texture);
+        ScheduleDecode(texture);
+        return texture;
+    }
+
+    void TextureManager::ScheduleDecode(const TextureHandle &texture)
+    {
+        ++stats_.pending_decodes;
+        job_system_.Schedule([this, texture]() { Decode(texture); }, {}, &decode_jobs_);
+    }
+
+    void TextureManager::Decode(const TextureHandle &texture)
+    {
+        DecodedImage result;
+        result.texture = texture;
+        const std::string &path = texture->path_;
+
+        // Taken before reading so a file modified meanwhile never matches the entry
+        TextureSourceInfo source;
+        const bool source_known =
+            disk_cache_ && disk_cache_->IsEnabled() && TextureDiskCache::QuerySource(path, source);
+        result.from_disk_cache = source_known && disk_cache_->Load(path, source, result.image);
+
+        std::vector<uint8_t> file;
+        if (result.from_disk_cache || ReadFile(path, file))
+        {
+            if (!result.from_disk_cache)
+            {
+                result.image.content_hash = HashBytes(file);
+            }
+
+            // A second path with the same bytes waits for the first decode instead
+            {
+                std::lock_guard<std::mutex> lock(hash_mutex_);
+                std::weak_ptr<Texture> &owner = by_content_[result.image.content_hash];
+                result.duplicate_of = owner.lock();
+                if (result.duplicate_of == texture)
+                {
+                    // Reload after eviction
+                    result.duplicate_of.reset();
+                }
+                else if (!result.duplicate_of)
+                {
+                    owner = texture;
+                }
+            }
+
+            if (result.duplicate_of)
+            {
+                result.image.mapping.Close();
+            }
+            else if (!result.from_disk_cache)
+            {
+                int width = 0;
+                int height = 0;
+                int channels = 0;
+                stbi_uc *pixels = stbi_load_from_memory(file.data(), static_cast<int>(file.size()),
+                                                        &width, &height, &channels,
+                                                        kBytesPerPixel);
+                if (pixels)
+                {
+                    result.image.Build(pixels, static_cast<uint32_t>(width),
+                                       static_cast<uint32_t>(height), config_.mipmaps);
+                    stbi_image_free(pixels);
+
+                    if (source_known)
+                    {
+                        result.stored_to_disk_cache =
+                            disk_cache_->Store(path, source, result.image);
+                    }
+                }
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(decoded_mutex_);
+            decoded_.push_back(std::move(result));
+        }
+
+        if (decoded_callback_)
+        {
+            decoded_callback_();
+        }
+    }
+
+    void TextureManager::Update()
+    {
+        ++frame_index_;
+        ReloadRequested();
+        AcceptDecodedImages();
+        UploadPending();
+        EvictLeastRecentlyUsed();
+        ReleaseUnused();
+
+        stats_.pending_uploads = static_cast<uint32_t>(uploads_.size());
+        stats_.resident_textures = static_cast<uint32_t>(resident_.size());
+    }
+
+    void TextureManager::MarkUsed(const ImDrawData &draw_data)
+    {
+        for (const ImDrawList *draw_list : draw_data.CmdLists)
+        {
+            for (const ImDrawCmd &command : draw_list->CmdBuffer)
+            {
+                MarkUsed(static_cast<uint32_t>((intptr_t)command.GetTexID()));
+            }
+        }
+    }
+
+    void TextureManager::MarkUsed(uint32_t texture_id)
+    {
+        auto it = resident_.find(texture_id);
+        if (it == resident_.end() || it->second.last_used_frame == frame_index_)
+        {
+            return;
+        }
+
+        it->second.last_used_frame = frame_index_;
+        lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    }
+
+    void TextureManager::ReloadRequested()
+    {
+        if (evicted_count_ == 0)
+        {
+            return;
+        }
+
+        for (auto &[path, texture] : textures_)
+        {
+            if (texture->state_ == TextureState::Evicted && texture->reload_requested_)
+            {
+                texture->state_ = TextureState::Loading;
+                texture->reload_requested_ = false;
+                --evicted_count_;
+                ScheduleDecode(texture);
+            }
+        }
+    }
+
+    void TextureManager::AcceptDecodedImages()
+    {
+        {
+            std::lock_guard<std::mutex> lock(decoded_mutex_);
+            accepted_.swap(decoded_);
+        }
+
+        for (DecodedImage &decoded : accepted_)
+        {
+            --stats_.pending_decodes;
+            Texture &texture = *decoded.texture;
+            const uint64_t content_hash = decoded.image.content_hash;
+            if (texture.content_hash_ != content_hash)
+            {
+                // The file changed on disk since it was evicted
+                std::lock_guard<std::mutex> lock(hash_mutex_);
+                auto owner = by_content_.find(texture.content_hash_);
+                if (owner != by_content_.end() && owner->second.lock() == decoded.texture)
+                {
+                    by_content_.erase(owner);
+                }
+            }
+            texture.content_hash_ = content_hash;
+            stats_.disk_cache_hits += decoded.from_disk_cache ? 1 : 0;
+            stats_.disk_cache_writes += decoded.stored_to_disk_cache ? 1 : 0;
+
+            if (decoded.duplicate_of)
+            {
+                texture.alias_ = std::move(decoded.duplicate_of);
+                ++stats_.deduplicated_loads;
+                ++stats_.cache_hits;
+                continue;
+            }
+
+            ++stats_.cache_misses;
+
+            const TextureImage &image = decoded.image;
+            if (!image.IsValid())
+            {
+                std::fprintf(stderr, "[Flux] Failed to load image '%s'\n",
+                             texture.path_.c_str());
+                texture.state_ = TextureState::Failed;
+                continue;
+            }
+
+            texture.width_ = image.width;
+            texture.height_ = image.height;
+
+            GLuint id = 0;
+            glGenTextures(1, &id);
+            glBindTexture(GL_TEXTURE_2D, id);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                            image.mip_count > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexStorage2D(GL_TEXTURE_2D, static_cast<GLsizei>(image.mip_count), GL_RGBA8,
+                           static_cast<GLsizei>(image.width),
+                           static_cast<GLsizei>(image.height));
+            texture.renderer_id_ = id;
+
+            // Fresh textures count as drawn so they get a full eviction window
+            ResidentTexture &entry = resident_[id];
+            entry.texture = &texture;
+            entry.bytes = image.GetByteSize();
+            entry.last_used_frame = frame_index_;
+            entry.lru_position = lru_.insert(lru_.begin(), id);
+            stats_.resident_bytes += entry.bytes;
+
+            PendingUpload upload;
+            upload.texture = std::move(decoded.texture);
+            upload.image = std::move(decoded.image);
+            uploads_.push_back(std::move(upload));
+        }
+        accepted_.clear();
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    void TextureManager::UploadPending()
+    {
+        stats_.uploaded_bytes_last_frame = 0;
+        if (uploads_.empty())
+        {
+            return;
+        }
+
+        // The segment was last written kStagingSegments frames ago, normally long done
+        void *&fence = segment_fences_[segment_index_];
+        if (fence)
+        {
+            glClientWaitSync(static_cast<GLsync>(fence), GL_SYNC_FLUSH_COMMANDS_BIT,
+                             1000000000ull);
+            glDeleteSync(static_cast<GLsync>(fence));
+            fence = nullptr;
+        }
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+        size_t staging_offset = 0;
+        const size_t budget = config_.upload_budget_bytes;
+        size_t uploaded = 0;
+        while (!uploads_.empty() && uploaded < budget)
+        {
+            PendingUpload &upload = uploads_.front();
+            const TextureImage &image = upload.image;
+            const uint32_t level_height = TextureImage::GetLevelExtent(image.height, upload.level);
+            const size_t row_bytes =
+                static_cast<size_t>(TextureImage::GetLevelExtent(image.width, upload.level)) *
+                kBytesPerPixel;
+            const uint32_t rows_left = level_height - upload.rows_uploaded;
+
+            // Always make progress, even when a single row exceeds the budget
+            uint32_t rows = static_cast<uint32_t>(
+                std::min<size_t>(rows_left, (budget - uploaded) / row_bytes));
+            if (rows == 0)
+            {
+                if (uploaded > 0)
+                {
+                    break;
+                }
+                rows = 1;
+            }
+
+            UploadRows(upload, rows, staging_offset);
+            uploaded += rows * row_bytes;
+
+            if (upload.rows_uploaded == level_height)
+            {
+                upload.rows_uploaded = 0;
+                if (++upload.level == image.mip_count)
+                {
+                    upload.texture->state_ = TextureState::Ready;
+                    uploads_.pop_front();
+                }
+            }
+        }
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+        if (staging_offset > 0)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        }
+        segment_index_ = (segment_index_ + 1) % kStagingSegments;
+
+        stats_.uploaded_bytes_last_frame = uploaded;
+        stats_.uploaded_bytes_total += uploaded;
+    }
+
+    void TextureManager::UploadRows(PendingUpload &upload, uint32_t row_count,
+                                    size_t &staging_offset)
+    {
+        const TextureImage &image = upload.image;
+        const GLsizei level_width =
+            static_cast<GLsizei>(TextureImage::GetLevelExtent(image.width, upload.level));
+        const size_t row_bytes = static_cast<size_t>(level_width) * kBytesPerPixel;
+        const size_t bytes = row_bytes * row_count;
+        const uint8_t *source = image.GetPixels() + image.GetLevelOffset(upload.level) +
+                                row_bytes * upload.rows_uploaded;
+        const GLint level = static_cast<GLint>(upload.level);
+        const GLint first_row = static_cast<GLint>(upload.rows_uploaded);
+
+        glBindTexture(GL_TEXTURE_2D, upload.texture->renderer_id_);
+
+        if (staging_memory_ && staging_offset + bytes <= segment_size_)
+        {
+            const size_t buffer_offset = segment_index_ * segment_size_ + staging_offset;
+            std::memcpy(staging_memory_ + buffer_offset, source, bytes);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging_buffer_);
+            glTexSubImage2D(GL_TEXTURE_2D, level, 0, first_row, level_width,
+                            static_cast<GLsizei>(row_count), GL_RGBA, GL_UNSIGNED_BYTE,
+                            reinterpret_cast<const void *>(buffer_offset));
+            staging_offset += bytes;
+        }
+        else
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            glTexSubImage2D(GL_TEXTURE_2D, level, 0, first_row, level_width,
+                            static_cast<GLsizei>(row_count), GL_RGBA, GL_UNSIGNED_BYTE, source);
+        }
+
+        upload.rows_uploaded += row_count;
+    }
+
+    void TextureManager::EvictLeastRecentlyUsed()
+    {
+        while (stats_.resident_bytes > config_.cache_budget_bytes && !lru_.empty())
+        {
+            const ResidentTexture &oldest = resident_.at(lru_.back());
+            if (frame_index_ - oldest.last_used_frame < config_.eviction_frames ||
+                oldest.texture->state_ != TextureState::Ready)
+            {
+                break;
+            }
+            Evict(lru_.back());
+        }
+    }
+
+    void TextureManager::Evict(uint32_t renderer_id)
+    {
+        auto it = resident_.find(renderer_id);
+        Texture &texture = *it->second.texture;
+        stats_.resident_bytes -= it->second.bytes;
+        lru_.erase(it->second.lru_position);
+        resident_.erase(it);
+
+        GLuint id = renderer_id;
+        glDeleteTextures(1, &id);
+        texture.renderer_id_ = 0;
+        texture.state_ = TextureState::Evicted;
+        texture.reload_requested_ = false;
+        ++evicted_count_;
+        ++stats_.evictions;
+    }
+
+    void TextureManager::ReleaseUnused()
+    {
+        // Decode jobs take references under hash_mutex_, so the count is stable here.
+        // Only the manager holding the handle means no user, job or pending upload.
+        // Unreferenced textures that are still on the GPU stay cached until evicted.
+        std::lock_guard<std::mutex> lock(hash_mutex_);
+        for (auto it = textures_.begin(); it != textures_.end();)
+        {
+            const Texture &texture = *it->second;
+            if (it->second.use_count() > 1 ||
+                (texture.state_ == TextureState::Ready && !texture.alias_))
+            {
+                ++it;
+                continue;
+            }
+
+            auto owner = by_content_.find(texture.content_hash_);
+            if (owner != by_content_.end() && owner->second.lock() == it->second)
+            {
+                by_content_.erase(owner);
+            }
+
+            if (texture.state_ == TextureState::Evicted)
+            {
+                --evicted_count_;
+            }
+            DestroyTexture(*it->second);
+            it = textures_.erase(it);
+        }
+    }
+
+    void TextureManager::DestroyTexture(Texture &texture)
+    {
+        if (texture.renderer_id_)
+        {
+            auto it = resident_.find(texture.renderer_id_);
+            if (it != resident_.end())
+            {
+                stats_.resident_bytes -= it->second.bytes;
+                lru_.erase(it->second.lru_position);
+                resident_.erase(it);
+            }
+
+            GLuint id = texture.renderer_id_;
+            glDeleteTextures(1, &id);
+            texture.renderer_id_ = 0;
+        }
+        texture.state_ = TextureState::Failed;
+        texture.alias_.reset();
+    }
+
+} // namespace flux
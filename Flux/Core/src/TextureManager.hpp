@@ -0,0 +1,179 @@
+// Copyright 2026 Beisent
+// Asynchronous image loading and texture upload for Flux framework
+
+#ifndef FLUX_CORE_SRC_TEXTUREMANAGER_HPP_
+#define FLUX_CORE_SRC_TEXTUREMANAGER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "JobSystem.hpp"
+#include "Texture.hpp"
+#include "TextureDiskCache.hpp"
+#include "TextureImage.hpp"
+
+namespace flux
+{
+
+    struct TextureManagerConfig
+    {
+        size_t upload_budget_bytes = 8 * 1024 * 1024;
+        size_t cache_budget_bytes = 512 * 1024 * 1024;
+        uint32_t eviction_frames = 300;
+        bool mipmaps = true;
+        std::string disk_cache_directory; // Empty disables the persistent cache
+    };
+
+    struct TextureManagerStats
+    {
+        uint32_t pending_decodes = 0;
+        uint32_t pending_uploads = 0;
+        uint32_t resident_textures = 0;
+        uint64_t resident_bytes = 0;
+        uint64_t cache_budget_bytes = 0;
+        uint64_t cache_hits = 0;   // Loads served without decoding
+        uint64_t cache_misses = 0; // Decodes, including reloads after eviction
+        uint64_t evictions = 0;
+        uint64_t disk_cache_hits = 0;   // Decodes skipped by mapping a cache entry
+        uint64_t disk_cache_writes = 0;
+        uint64_t uploaded_bytes_last_frame = 0;
+        uint64_t uploaded_bytes_total = 0;
+        uint64_t deduplicated_loads = 0;
+        bool persistent_staging = false;
+    };
+
+    // Files are read and decoded with stb_image on the job system. The GL thread
+    // uploads the results in Update() through a persistently mapped pixel buffer
+    // ring, a few rows at a time, so no frame uploads more than the byte budget.
+    //
+    // GPU textures are cached by content hash. Above the cache budget, textures that
+    // no ImGui draw referenced for eviction_frames frames are evicted least recently
+    // drawn first. Their handles stay valid and reload on the next draw.
+    //
+    // With a disk cache directory configured, decoded mip chains are written there
+    // and memory-mapped back on later runs, skipping the PNG/JPEG decode.
+    class TextureManager
+    {
+    public:
+        static constexpr size_t kStagingSegments = 3;
+
+        explicit TextureManager(JobSystem &job_system);
+        ~TextureManager();
+
+        TextureManager(const TextureManager &) = delete;
+        TextureManager &operator=(const TextureManager &) = delete;
+
+        // GL thread
+        void Init(const TextureManagerConfig &config);
+        void Shutdown();
+
+        // Main thread. A path already known returns the same handle.
+        TextureHandle Load(const std::string &path);
+
+        // GL thread, once per frame: takes decoded images, uploads within the budget
+        // and releases textures nobody references anymore
+        void Update();
+
+        // GL thread, after ImGui::Render: records which textures were drawn this frame
+        void MarkUsed(const ImDrawData &draw_data);
+        // GL thread: the same for a texture drawn outside ImGui; ids it does not own
+        // are ignored
+        void MarkUsed(uint32_t texture_id);
+
+        // Invoked on a worker thread whenever a decode finishes, e.g. to wake a sleeping loop
+        void SetDecodedCallback(std::function<void()> callback)
+        {
+            decoded_callback_ = std::move(callback);
+        }
+        [[nodiscard]] bool HasPendingUploads() const { return !uploads_.empty(); }
+
+        [[nodiscard]] ImTextureID GetPlaceholder() const
+        {
+            return (ImTextureID)(intptr_t)placeholder_id_;
+        }
+        [[nodiscard]] const TextureManagerStats &GetStats() const { return stats_; }
+
+    private:
+        struct DecodedImage
+        {
+            TextureHandle texture;
+            TextureHandle duplicate_of;
+            TextureImage image;
+            bool from_disk_cache = false;
+            bool stored_to_disk_cache = false;
+        };
+
+        struct PendingUpload
+        {
+            TextureHandle texture;
+            TextureImage image;
+            uint32_t level = 0;
+            uint32_t rows_uploaded = 0; // Within the current level
+        };
+
+        struct ResidentTexture
+        {
+            Texture *texture = nullptr;
+            size_t bytes = 0;
+            uint64_t last_used_frame = 0;
+            std::list<uint32_t>::iterator lru_position;
+        };
+
+        void ScheduleDecode(const TextureHandle &texture);
+        void Decode(const TextureHandle &texture);
+        void AcceptDecodedImages();
+        void UploadPending();
+        void UploadRows(PendingUpload &upload, uint32_t row_count, size_t &staging_offset);
+        void ReloadRequested();
+        void EvictLeastRecentlyUsed();
+        void Evict(uint32_t renderer_id);
+        void ReleaseUnused();
+        void CreateStagingBuffer();
+        void DestroyTexture(Texture &texture);
+
+        JobSystem &job_system_;
+        JobGroup decode_jobs_;
+        std::unique_ptr<TextureDiskCache> disk_cache_;
+
+        std::unordered_map<std::string, TextureHandle> textures_;
+        std::deque<PendingUpload> uploads_;
+        std::vector<DecodedImage> accepted_;
+
+        std::mutex decoded_mutex_;
+        std::vector<DecodedImage> decoded_;
+        std::function<void()> decoded_callback_;
+
+        // Content hash -> texture decoding or holding those bytes
+        std::mutex hash_mutex_;
+        std::unordered_map<uint64_t, std::weak_ptr<Texture>> by_content_;
+
+        // GL id -> cache entry, lru_ holds GL ids with the most recently drawn in front
+        std::unordered_map<uint32_t, ResidentTexture> resident_;
+        std::list<uint32_t> lru_;
+        uint64_t frame_index_ = 0;
+        uint32_t evicted_count_ = 0;
+
+        TextureManagerConfig config_;
+        uint32_t placeholder_id_ = 0;
+
+        uint32_t staging_buffer_ = 0;
+        uint8_t *staging_memory_ = nullptr;
+        size_t segment_size_ = 0;
+        size_t segment_index_ = 0;
+        std::array<void *, kStagingSegments> segment_fences_{};
+
+        TextureManagerStats stats_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_TEXTUREMANAGER_HPP_
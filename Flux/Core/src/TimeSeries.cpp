@@ -0,0 +1,306 @@
+// Copyright 2026 Beisent
+// TimeSeries implementation
+
+#include "TimeSeries.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLUX_TIMESERIES_SSE 1
+#include <xmmintrin.h>
+#endif
+
+namespace flux
+{
+
+    namespace
+    {
+        static_assert(TimeSeries::kLevelFactor == 8, "ReduceBlocks reduces blocks of 8");
+        static_assert(TimeSeries::kChunkSize % TimeSeries::kLevelFactor == 0,
+                      "Blocks must not straddle chunks");
+
+        // Folds count elements into min_out / max_out
+        void ReduceSpan(const float *mins, const float *maxs, size_t count, float &min_out,
+                        float &max_out)
+        {
+            float low = min_out;
+            float high = max_out;
+            size_t i = 0;
+#if FLUX_TIMESERIES_SSE
+            if (count >= 4)
+            {
+                __m128 vlow = _mm_set1_ps(low);
+                __m128 vhigh = _mm_set1_ps(high);
+                for (; i + 4 <= count; i += 4)
+                {
+                    vlow = _mm_min_ps(vlow, _mm_loadu_ps(mins + i));
+                    vhigh = _mm_max_ps(vhigh, _mm_loadu_ps(maxs + i));
+                }
+                vlow = _mm_min_ps(vlow, _mm_shuffle_ps(vlow, vlow, _MM_SHUFFLE(1, 0, 3, 2)));
+                vlow = _mm_min_ss(vlow, _mm_shuffle_ps(vlow, vlow, _MM_SHUFFLE(2, 3, 0, 1)));
+                vhigh = _mm_max_ps(vhigh, _mm_shuffle_ps(vhigh, vhigh, _MM_SHUFFLE(1, 0, 3, 2)));
+                vhigh = _mm_max_ss(vhigh, _mm_shuffle_ps(vhigh, vhigh, _MM_SHUFFLE(2, 3, 0, 1)));
+                low = _mm_cvtss_f32(vlow);
+                high = _mm_cvtss_f32(vhigh);
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                low = mins[i] < low ? mins[i] : low;
+                high = maxs[i] > high ? maxs[i] : high;
+            }
+            min_out = low;
+            max_out = high;
+        }
+
+        // One output element per full block of 8 inputs
+        void ReduceBlocks(const float *mins, const float *maxs, size_t blocks, float *min_out,
+                          float *max_out)
+        {
+            size_t b = 0;
+#if FLUX_TIMESERIES_SSE
+            // Four blocks at a time: pairwise within each block, then a transpose
+            // puts the four partial results of a block in one lane
+            for (; b + 4 <= blocks; b += 4)
+            {
+                const float *lo = mins + b * 8;
+                const float *hi = maxs + b * 8;
+                __m128 l0 = _mm_min_ps(_mm_loadu_ps(lo + 0), _mm_loadu_ps(lo + 4));
+                __m128 l1 = _mm_min_ps(_mm_loadu_ps(lo + 8), _mm_loadu_ps(lo + 12));
+                __m128 l2 = _mm_min_ps(_mm_loadu_ps(lo + 16), _mm_loadu_ps(lo + 20));
+                __m128 l3 = _mm_min_ps(_mm_loadu_ps(lo + 24), _mm_loadu_ps(lo + 28));
+                _MM_TRANSPOSE4_PS(l0, l1, l2, l3);
+                _mm_storeu_ps(min_out + b, _mm_min_ps(_mm_min_ps(l0, l1), _mm_min_ps(l2, l3)));
+
+                __m128 h0 = _mm_max_ps(_mm_loadu_ps(hi + 0), _mm_loadu_ps(hi + 4));
+                __m128 h1 = _mm_max_ps(_mm_loadu_ps(hi + 8), _mm_loadu_ps(hi + 12));
+                __m128 h2 = _mm_max_ps(_mm_loadu_ps(hi + 16), _mm_loadu_ps(hi + 20));
+                __m128 h3 = _mm_max_ps(_mm_loadu_ps(hi + 24), _mm_loadu_ps(hi + 28));
+                _MM_TRANSPOSE4_PS(h0, h1, h2, h3);
+                _mm_storeu_ps(max_out + b, _mm_max_ps(_mm_max_ps(h0, h1), _mm_max_ps(h2, h3)));
+            }
+#endif
+            for (; b < blocks; ++b)
+            {
+                min_out[b] = mins[b * 8];
+                max_out[b] = maxs[b * 8];
+                ReduceSpan(mins + b * 8 + 1, maxs + b * 8 + 1, 7, min_out[b], max_out[b]);
+            }
+        }
+    } // namespace
+
+    void TimeSeries::Append(const float *values, size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        if (levels_.empty())
+        {
+            levels_.emplace_back();
+        }
+
+        Level &samples = levels_[0];
+        const size_t old_size = samples.size;
+        Resize(samples, old_size + count, false);
+        samples.size = old_size + count;
+        for (size_t index = old_size; count > 0;)
+        {
+            const size_t offset = index % kChunkSize;
+            const size_t n = std::min(count, kChunkSize - offset);
+            std::memcpy(samples.min_chunks[index / kChunkSize].data() + offset, values,
+                        n * sizeof(float));
+            values += n;
+            index += n;
+            count -= n;
+        }
+
+        // Only elements covering new samples change on each level; a level is
+        // added while the one below has more than one block
+        size_t first_dirty = old_size;
+        for (size_t level = 1; levels_[level - 1].size > kLevelFactor; ++level)
+        {
+            if (level == levels_.size())
+            {
+                levels_.emplace_back();
+            }
+            first_dirty = std::min(first_dirty / kLevelFactor, levels_[level].size);
+            RebuildLevel(level, first_dirty);
+        }
+    }
+
+    void TimeSeries::Clear()
+    {
+        levels_.clear();
+        ++version_;
+    }
+
+    float TimeSeries::GetSample(size_t index) const
+    {
+        return levels_[0].min_chunks[index / kChunkSize][index % kChunkSize];
+    }
+
+    double TimeSeries::GetLevelSpan(size_t level)
+    {
+        double span = 1.0;
+        for (size_t i = 0; i < level; ++i)
+        {
+            span *= static_cast<double>(kLevelFactor);
+        }
+        return span;
+    }
+
+    size_t TimeSeries::ChooseLevel(double samples_per_column) const
+    {
+        size_t level = 0;
+        while (level + 1 < levels_.size() && GetLevelSpan(level + 1) <= samples_per_column)
+        {
+            ++level;
+        }
+        return level;
+    }
+
+    const float *TimeSeries::GetChunk(size_t level, size_t chunk, bool max) const
+    {
+        const Level &entry = levels_[level];
+        return (max && level > 0 ? entry.max_chunks[chunk] : entry.min_chunks[chunk]).data();
+    }
+
+    void TimeSeries::Resize(Level &level, size_t size, bool has_max)
+    {
+        const size_t chunks = (size + kChunkSize - 1) / kChunkSize;
+        level.min_chunks.resize(chunks);
+        if (has_max)
+        {
+            level.max_chunks.resize(chunks);
+        }
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            const size_t chunk_size = std::min(kChunkSize, size - chunk * kChunkSize);
+            if (level.min_chunks[chunk].size() < chunk_size)
+            {
+                level.min_chunks[chunk].resize(chunk_size);
+                if (has_max)
+                {
+                    level.max_chunks[chunk].resize(chunk_size);
+                }
+            }
+        }
+    }
+
+    void TimeSeries::RebuildLevel(size_t level, size_t first)
+    {
+        const Level &below = levels_[level - 1];
+        Level &entry = levels_[level];
+        const size_t size = (below.size + kLevelFactor - 1) / kLevelFactor;
+        Resize(entry, size, true);
+
+        for (size_t element = first; element < size;)
+        {
+            const size_t below_index = element * kLevelFactor;
+            const size_t below_offset = below_index % kChunkSize;
+            const size_t offset = element % kChunkSize;
+            const float *mins = below.min_chunks[below_index / kChunkSize].data() + below_offset;
+            const float *maxs = level == 1
+                                    ? mins
+                                    : below.max_chunks[below_index / kChunkSize].data() +
+                                          below_offset;
+            float *min_out = entry.min_chunks[element / kChunkSize].data() + offset;
+            float *max_out = entry.max_chunks[element / kChunkSize].data() + offset;
+
+            // Up to whichever chunk ends first
+            const size_t run = std::min({size - element, kChunkSize - offset,
+                                         (kChunkSize - below_offset) / kLevelFactor});
+            const size_t full = std::min(run, (below.size - below_index) / kLevelFactor);
+            ReduceBlocks(mins, maxs, full, min_out, max_out);
+            if (full < run)
+            {
+                // Partial last block
+                const size_t rest = below.size - below_index - full * kLevelFactor;
+                min_out[full] = std::numeric_limits<float>::infinity();
+                max_out[full] = -std::numeric_limits<float>::infinity();
+                ReduceSpan(mins + full * kLevelFactor, maxs + full * kLevelFactor, rest,
+                           min_out[full], max_out[full]);
+                element += full + 1;
+            }
+            else
+            {
+                element += run;
+            }
+        }
+        entry.size = size;
+    }
+
+    void TimeSeries::Reduce(size_t level, size_t first, size_t last, float &min_out,
+                            float &max_out) const
+    {
+        const Level &entry = levels_[level];
+        while (first < last)
+        {
+            const size_t chunk = first / kChunkSize;
+            const size_t offset = first % kChunkSize;
+            const size_t n = std::min(last - first, kChunkSize - offset);
+            const float *mins = entry.min_chunks[chunk].data() + offset;
+            const float *maxs = level == 0 ? mins : entry.max_chunks[chunk].data() + offset;
+            ReduceSpan(mins, maxs, n, min_out, max_out);
+            first += n;
+        }
+    }
+
+    void TimeSeries::Decimate(double first, double last, size_t columns, float *min_out,
+                              float *max_out) const
+    {
+        constexpr float kInfinity = std::numeric_limits<float>::infinity();
+        std::fill(min_out, min_out + columns, kInfinity);
+        std::fill(max_out, max_out + columns, -kInfinity);
+        if (columns == 0 || levels_.empty() || !(last > first))
+        {
+            return;
+        }
+
+        const double samples_per_column = (last - first) / static_cast<double>(columns);
+        const size_t level = ChooseLevel(samples_per_column);
+        const double span = GetLevelSpan(level);
+        const double level_size = static_cast<double>(levels_[level].size);
+        for (size_t column = 0; column < columns; ++column)
+        {
+            const double from = first + samples_per_column * static_cast<double>(column);
+            const double begin = std::max(std::floor(from / span), 0.0);
+            const double end = std::min(std::ceil((from + samples_per_column) / span), level_size);
+            if (begin < end)
+            {
+                Reduce(level, static_cast<size_t>(begin), static_cast<size_t>(end),
+                       min_out[column], max_out[column]);
+            }
+        }
+    }
+
+    bool TimeSeries::GetBounds(double first, double last, float &min_out, float &max_out) const
+    {
+        // About a thousand elements whatever the range
+        constexpr double kBoundsElements = 1024.0;
+        if (levels_.empty() || !(last > first))
+        {
+            return false;
+        }
+
+        const size_t level = ChooseLevel((last - first) / kBoundsElements);
+        const double span = GetLevelSpan(level);
+        const double begin = std::max(std::floor(first / span), 0.0);
+        const double end =
+            std::min(std::ceil(last / span), static_cast<double>(levels_[level].size));
+        if (!(begin < end))
+        {
+            return false;
+        }
+
+        min_out = std::numeric_limits<float>::infinity();
+        max_out = -std::numeric_limits<float>::infinity();
+        Reduce(level, static_cast<size_t>(begin), static_cast<size_t>(end), min_out, max_out);
+        return true;
+    }
+
+} // namespace flux
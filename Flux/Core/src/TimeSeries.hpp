@@ -0,0 +1,78 @@
+// Copyright 2026 Beisent
+// Append-only sample series with a min/max level-of-detail pyramid
+
+#ifndef FLUX_CORE_SRC_TIMESERIES_HPP_
+#define FLUX_CORE_SRC_TIMESERIES_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flux
+{
+
+    // Evenly spaced float samples, stored in chunks of kChunkSize so growing copies
+    // at most one chunk. Level 0 is the samples themselves; each element of level
+    // k holds the min and max of kLevelFactor elements of level k - 1. Appends
+    // update only the tail of every level, and a query over any range reads about
+    // 2 * kLevelFactor elements per output column whatever the zoom.
+    class TimeSeries
+    {
+    public:
+        static constexpr size_t kLevelFactor = 8;
+        // 16 MB of floats, the smallest shader storage block GL 4.3 guarantees
+        static constexpr size_t kChunkSize = size_t(1) << 22;
+
+        TimeSeries() = default;
+        TimeSeries(const TimeSeries &) = delete;
+        TimeSeries &operator=(const TimeSeries &) = delete;
+
+        void Append(const float *values, size_t count);
+        void Append(float value) { Append(&value, 1); }
+        void Clear();
+
+        [[nodiscard]] size_t GetSize() const { return levels_.empty() ? 0 : levels_[0].size; }
+        [[nodiscard]] float GetSample(size_t index) const;
+        // Changes on Clear(), appends keep it
+        [[nodiscard]] uint64_t GetVersion() const { return version_; }
+
+        [[nodiscard]] size_t GetLevelCount() const { return levels_.size(); }
+        [[nodiscard]] size_t GetLevelSize(size_t level) const { return levels_[level].size; }
+        // Samples per element of the level
+        [[nodiscard]] static double GetLevelSpan(size_t level);
+        // Finest level with elements no wider than samples_per_column, so a column
+        // covers at most about kLevelFactor of them
+        [[nodiscard]] size_t ChooseLevel(double samples_per_column) const;
+        // Chunk of a level's minima or maxima; both are the samples on level 0
+        [[nodiscard]] const float *GetChunk(size_t level, size_t chunk, bool max) const;
+
+        // Min and max of `columns` equal slices of the sample range [first, last).
+        // Slices are widened to whole elements of the chosen level; slices without
+        // data get min > max.
+        void Decimate(double first, double last, size_t columns, float *min_out,
+                      float *max_out) const;
+        // Bounds of [first, last) from a coarse level, possibly including samples
+        // just outside it; false when the range holds no samples
+        bool GetBounds(double first, double last, float &min_out, float &max_out) const;
+
+    private:
+        struct Level
+        {
+            std::vector<std::vector<float>> min_chunks;
+            std::vector<std::vector<float>> max_chunks; // Unused on level 0
+            size_t size = 0;
+        };
+
+        static void Resize(Level &level, size_t size, bool has_max);
+        // Recomputes elements [first, size) of the level from the one below
+        void RebuildLevel(size_t level, size_t first);
+        void Reduce(size_t level, size_t first, size_t last, float &min_out,
+                    float &max_out) const;
+
+        std::vector<Level> levels_;
+        uint64_t version_ = 0;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_TIMESERIES_HPP_
@@ -0,0 +1,692 @@
+// Copyright 2026 Beisent
+// TimeSeriesPlot implementation
+
+#include "TimeSeriesPlot.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#include <glad/glad.h>
+
+#include "Application.hpp"
+
+namespace flux
+{
+
+    namespace
+    {
+        constexpr size_t kMinGpuChunkCapacity = 64 * 1024;
+        constexpr double kMinVisibleSamples = 4.0;
+        constexpr double kZoomPerWheelStep = 0.8;
+        constexpr float kYMargin = 0.05f;
+        constexpr float kBackground[4] = {0.06f, 0.06f, 0.07f, 1.0f};
+
+        // Bindings 0 and 1 hold the minima of the chunk the draw starts in and of
+        // the next one, 2 and 3 the maxima; on level 0 both pairs are the samples.
+        // u_mode 0 draws samples u_base.. as a strip, u_phase samples left of the
+        // view and u_step NDC units apart. u_mode 1 draws a vertical line per
+        // column over the elements it covers, u_phase being the element position
+        // of column 0 and u_step elements per column.
+        constexpr const char *kVertexShader = R"(#version 430 core
+layout(std430, binding = 0) readonly buffer LowMin { float low_min[]; };
+layout(std430, binding = 1) readonly buffer HighMin { float high_min[]; };
+layout(std430, binding = 2) readonly buffer LowMax { float low_max[]; };
+layout(std430, binding = 3) readonly buffer HighMax { float high_max[]; };
+
+uniform int u_mode;
+uniform int u_base;
+uniform int u_count; // Elements readable from u_base
+uniform int u_chunk_size;
+uniform float u_phase;
+uniform float u_step;
+uniform vec2 u_viewport;
+uniform vec2 u_y_range; // min, NDC per unit
+
+float ReadMin(int i)
+{
+    return i < u_chunk_size ? low_min[i] : high_min[i - u_chunk_size];
+}
+
+float ReadMax(int i)
+{
+    return i < u_chunk_size ? low_max[i] : high_max[i - u_chunk_size];
+}
+
+float ToY(float value)
+{
+    return (value - u_y_range.x) * u_y_range.y - 1.0;
+}
+
+void main()
+{
+    if (u_mode == 0)
+    {
+        float x = (float(gl_VertexID) - u_phase) * u_step - 1.0;
+        gl_Position = vec4(x, ToY(ReadMin(u_base + gl_VertexID)), 0.0, 1.0);
+        return;
+    }
+
+    int column = gl_VertexID / 2;
+    float start = u_phase + float(column) * u_step;
+    // One element to the left joins each column to its neighbour
+    int first = max(int(floor(start)) - 1, 0);
+    int last = min(int(ceil(start + u_step)), u_count);
+    if (first >= last)
+    {
+        gl_Position = vec4(2.0, 2.0, 0.0, 1.0);
+        return;
+    }
+
+    float low = ReadMin(u_base + first);
+    float high = ReadMax(u_base + first);
+    for (int i = first + 1; i < last; ++i)
+    {
+        low = min(low, ReadMin(u_base + i));
+        high = max(high, ReadMax(u_base + i));
+    }
+
+    // At least a pixel tall, so flat stretches stay visible
+    float y0 = ToY(low);
+    float y1 = ToY(high);
+    float pixel = 2.0 / u_viewport.y;
+    if (y1 - y0 < pixel)
+    {
+        float middle = 0.5 * (y0 + y1);
+        y0 = middle - 0.5 * pixel;
+        y1 = middle + 0.5 * pixel;
+    }
+    float x = (float(column) + 0.5) / u_viewport.x * 2.0 - 1.0;
+    gl_Position = vec4(x, (gl_VertexID & 1) == 0 ? y0 : y1, 0.0, 1.0);
+}
+)";
+
+        constexpr const char *kFragmentShader = R"(#version 430 core
+uniform vec4 u_color;
+out vec4 o_color;
+
+void main()
+{
+    o_color = u_color;
+}
+)";
+
+        GLuint CompileShader(GLenum type, const char *source)
+        {
+            GLuint shader = glCreateShader(type);
+            glShaderSource(shader, 1, &source, nullptr);
+            glCompileShader(shader);
+
+            GLint compiled = GL_FALSE;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+            if (!compiled)
+            {
+                char log[1024] = {};
+                glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+                std::fprintf(stderr, "[Flux] TimeSeriesPlot shader failed to compile: %s\n", log);
+                glDeleteShader(shader);
+                return 0;
+            }
+            return shader;
+        }
+    } // namespace
+
+    bool TimeSeriesPlot::DrawnState::operator==(const DrawnState &other) const
+    {
+        return first == other.first && last == other.last && y_min == other.y_min &&
+               y_max == other.y_max && width == other.width && height == other.height &&
+               sizes == other.sizes && versions == other.versions;
+    }
+
+    TimeSeriesPlot::~TimeSeriesPlot()
+    {
+        ClearSeries();
+        if (program_)
+        {
+            glDeleteProgram(program_);
+        }
+        if (vertex_array_)
+        {
+            glDeleteVertexArrays(1, &vertex_array_);
+        }
+    }
+
+    void TimeSeriesPlot::AddSeries(const TimeSeries &series, uint32_t color)
+    {
+        Series entry;
+        entry.series = &series;
+        entry.color = color;
+        entry.version = series.GetVersion();
+        series_.push_back(std::move(entry));
+        cpu_series_.resize(series_.size());
+    }
+
+    void TimeSeriesPlot::ClearSeries()
+    {
+        for (Series &entry : series_)
+        {
+            DestroyBuffers(entry);
+        }
+        series_.clear();
+        cpu_series_.clear();
+    }
+
+    void TimeSeriesPlot::SetView(double first, double last)
+    {
+        view_first_ = first;
+        view_last_ = last;
+        fit_all_ = false;
+        following_ = false;
+    }
+
+    bool TimeSeriesPlot::InitGpu()
+    {
+        // Sample buffers are read from the vertex shader
+        GLint vertex_storage_blocks = 0;
+        if (GLAD_GL_VERSION_4_3)
+        {
+            glGetIntegerv(GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS, &vertex_storage_blocks);
+        }
+        if (vertex_storage_blocks < 4)
+        {
+            std::fprintf(stderr, "[Flux] TimeSeriesPlot decimates on the CPU, no vertex "
+                                 "shader storage buffers\n");
+            return false;
+        }
+
+        const GLuint vertex_shader = CompileShader(GL_VERTEX_SHADER, kVertexShader);
+        const GLuint fragment_shader = CompileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+        if (!vertex_shader || !fragment_shader)
+        {
+            glDeleteShader(vertex_shader);
+            glDeleteShader(fragment_shader);
+            return false;
+        }
+
+        program_ = glCreateProgram();
+        glAttachShader(program_, vertex_shader);
+        glAttachShader(program_, fragment_shader);
+        glLinkProgram(program_);
+        glDeleteShader(vertex_shader);
+        glDeleteShader(fragment_shader);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program_, GL_LINK_STATUS, &linked);
+        if (!linked)
+        {
+            char log[1024] = {};
+            glGetProgramInfoLog(program_, sizeof(log), nullptr, log);
+            std::fprintf(stderr, "[Flux] TimeSeriesPlot program failed to link: %s\n", log);
+            glDeleteProgram(program_);
+            program_ = 0;
+            return false;
+        }
+
+        mode_location_ = glGetUniformLocation(program_, "u_mode");
+        base_location_ = glGetUniformLocation(program_, "u_base");
+        count_location_ = glGetUniformLocation(program_, "u_count");
+        phase_location_ = glGetUniformLocation(program_, "u_phase");
+        step_location_ = glGetUniformLocation(program_, "u_step");
+        viewport_location_ = glGetUniformLocation(program_, "u_viewport");
+        y_range_location_ = glGetUniformLocation(program_, "u_y_range");
+        color_location_ = glGetUniformLocation(program_, "u_color");
+        glUseProgram(program_);
+        glUniform1i(glGetUniformLocation(program_, "u_chunk_size"),
+                    static_cast<GLint>(TimeSeries::kChunkSize));
+        glUseProgram(0);
+
+        // Vertices come from gl_VertexID alone, core profile still needs a VAO
+        glGenVertexArrays(1, &vertex_array_);
+
+        RenderTargetSpecification specification;
+        specification.samples = 0;
+        specification.depth = false;
+        target_ = Application::Get().CreateRenderTarget(specification);
+        return true;
+    }
+
+    void TimeSeriesPlot::DestroyBuffers(Series &series)
+    {
+        for (GpuLevel &level : series.levels)
+        {
+            for (GpuChunk &chunk : level.chunks)
+            {
+                if (chunk.min_buffer)
+                {
+                    glDeleteBuffers(1, &chunk.min_buffer);
+                }
+                if (chunk.max_buffer)
+                {
+                    glDeleteBuffers(1, &chunk.max_buffer);
+                }
+            }
+        }
+        series.levels.clear();
+    }
+
+    void TimeSeriesPlot::SyncBuffers(Series &series)
+    {
+        const TimeSeries &source = *series.series;
+        if (series.version != source.GetVersion())
+        {
+            DestroyBuffers(series);
+            series.version = source.GetVersion();
+        }
+
+        series.levels.resize(source.GetLevelCount());
+        for (size_t level = 0; level < series.levels.size(); ++level)
+        {
+            GpuLevel &gpu_level = series.levels[level];
+            const size_t size = source.GetLevelSize(level);
+            // Samples never change, the last element of a coarser level may have
+            size_t first = gpu_level.synced;
+            if (level > 0 && first > 0)
+            {
+                --first;
+            }
+            if (first < size)
+            {
+                Upload(series, level, first, size);
+            }
+            gpu_level.synced = size;
+        }
+    }
+
+    void TimeSeriesPlot::Upload(Series &series, size_t level, size_t first, size_t last)
+    {
+        GpuLevel &gpu_level = series.levels[level];
+        const TimeSeries &source = *series.series;
+        const bool has_max = level > 0;
+        gpu_level.chunks.resize((last + TimeSeries::kChunkSize - 1) / TimeSeries::kChunkSize);
+
+        while (first < last)
+        {
+            const size_t chunk_index = first / TimeSeries::kChunkSize;
+            size_t offset = first % TimeSeries::kChunkSize;
+            const size_t end = std::min(last - chunk_index * TimeSeries::kChunkSize,
+                                        TimeSeries::kChunkSize);
+            GpuChunk &chunk = gpu_level.chunks[chunk_index];
+
+            // Buffers grow by doubling up to a full chunk; a new one is filled
+            // from the start of the chunk
+            if (end > chunk.capacity)
+            {
+                chunk.capacity = std::min(TimeSeries::kChunkSize,
+                                          std::max(kMinGpuChunkCapacity, end * 2));
+                const GLsizeiptr bytes = static_cast<GLsizeiptr>(chunk.capacity * sizeof(float));
+                auto recreate = [bytes](uint32_t &buffer)
+                {
+                    if (buffer)
+                    {
+                        glDeleteBuffers(1, &buffer);
+                    }
+                    glGenBuffers(1, &buffer);
+                    glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer);
+                    glBufferData(GL_SHADER_STORAGE_BUFFER, bytes, nullptr, GL_DYNAMIC_DRAW);
+                };
+                recreate(chunk.min_buffer);
+                if (has_max)
+                {
+                    recreate(chunk.max_buffer);
+                }
+                offset = 0;
+            }
+
+            const GLintptr byte_offset = static_cast<GLintptr>(offset * sizeof(float));
+            const GLsizeiptr bytes = static_cast<GLsizeiptr>((end - offset) * sizeof(float));
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, chunk.min_buffer);
+            glBufferSubData(GL_SHADER_STORAGE_BUFFER, byte_offset, bytes,
+                            source.GetChunk(level, chunk_index, false) + offset);
+            stats_.uploaded_bytes += static_cast<uint64_t>(bytes);
+            if (has_max)
+            {
+                glBindBuffer(GL_SHADER_STORAGE_BUFFER, chunk.max_buffer);
+                glBufferSubData(GL_SHADER_STORAGE_BUFFER, byte_offset, bytes,
+                                source.GetChunk(level, chunk_index, true) + offset);
+                stats_.uploaded_bytes += static_cast<uint64_t>(bytes);
+            }
+            first = chunk_index * TimeSeries::kChunkSize + end;
+        }
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    }
+
+    void TimeSeriesPlot::Draw(const char *id, const ImVec2 &size)
+    {
+        const ImVec2 available = ImGui::GetContentRegionAvail();
+        const ImVec2 plot_size(std::max(size.x > 0.0f ? size.x : available.x, 1.0f),
+                               std::max(size.y > 0.0f ? size.y : available.y, 1.0f));
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        ImGui::InvisibleButton(id, plot_size);
+        const bool hovered = ImGui::IsItemHovered();
+        const bool active = ImGui::IsItemActive();
+
+        size_t total_samples = 0;
+        for (const Series &entry : series_)
+        {
+            total_samples = std::max(total_samples, entry.series->GetSize());
+        }
+        const double total = static_cast<double>(total_samples);
+
+        // New samples scroll a view that showed the last one
+        if (following_ && !fit_all_)
+        {
+            const double length = view_last_ - view_first_;
+            view_last_ = total;
+            view_first_ = total - length;
+        }
+        HandleInput(origin, plot_size, hovered, active);
+        ClampView(total);
+        UpdateYRange();
+
+        const uint32_t width = static_cast<uint32_t>(plot_size.x);
+        const uint32_t height = static_cast<uint32_t>(plot_size.y);
+        if (gpu_state_ == GpuState::Unknown && !force_cpu_)
+        {
+            gpu_state_ = InitGpu() ? GpuState::Ready : GpuState::Unavailable;
+        }
+        const bool gpu = gpu_state_ == GpuState::Ready && !force_cpu_;
+
+        DrawnState state;
+        state.first = view_first_;
+        state.last = view_last_;
+        state.y_min = y_min_;
+        state.y_max = y_max_;
+        state.width = width;
+        state.height = height;
+        for (const Series &entry : series_)
+        {
+            state.sizes.push_back(entry.series->GetSize());
+            state.versions.push_back(entry.series->GetVersion());
+        }
+        if (!(state == drawn_) || gpu != drawn_gpu_)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            if (gpu)
+            {
+                RenderGpu(width, height);
+            }
+            else
+            {
+                DecimateCpu(width);
+            }
+            stats_.redraw_ms = std::chrono::duration<double, std::milli>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count();
+            ++stats_.redraws;
+            stats_.gpu = gpu;
+            drawn_ = std::move(state);
+            drawn_gpu_ = gpu;
+        }
+
+        ImDrawList *draw_list = ImGui::GetWindowDrawList();
+        const ImVec2 end(origin.x + plot_size.x, origin.y + plot_size.y);
+        if (gpu)
+        {
+            draw_list->AddImage(target_->GetImTextureID(), origin, end, target_->GetUV0(),
+                                target_->GetUV1());
+        }
+        else
+        {
+            draw_list->AddRectFilled(origin, end, ImGui::ColorConvertFloat4ToU32(ImVec4(
+                                                      kBackground[0], kBackground[1],
+                                                      kBackground[2], kBackground[3])));
+            draw_list->PushClipRect(origin, end, true);
+            DrawCpu(draw_list, origin, plot_size);
+            draw_list->PopClipRect();
+        }
+        draw_list->AddRect(origin, end, ImGui::GetColorU32(ImGuiCol_Border));
+    }
+
+    void TimeSeriesPlot::HandleInput(const ImVec2 &origin, const ImVec2 &size, bool hovered,
+                                     bool active)
+    {
+        const ImGuiIO &io = ImGui::GetIO();
+        const double length = view_last_ - view_first_;
+        if (hovered && io.MouseWheel != 0.0f)
+        {
+            const double anchor =
+                view_first_ + static_cast<double>((io.MousePos.x - origin.x) / size.x) * length;
+            const double zoomed =
+                std::max(length * std::pow(kZoomPerWheelStep, static_cast<double>(io.MouseWheel)),
+                         kMinVisibleSamples);
+            view_first_ = anchor - (anchor - view_first_) * zoomed / length;
+            view_last_ = view_first_ + zoomed;
+            fit_all_ = false;
+        }
+        if (active && ImGui::IsMouseDragging(ImGuiMouseButton_Left, 0.0f) &&
+            io.MouseDelta.x != 0.0f)
+        {
+            const double shift = -static_cast<double>(io.MouseDelta.x / size.x) * length;
+            view_first_ += shift;
+            view_last_ += shift;
+            fit_all_ = false;
+        }
+        if (hovered && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+        {
+            fit_all_ = true;
+        }
+    }
+
+    void TimeSeriesPlot::ClampView(double total)
+    {
+        if (fit_all_ || total <= kMinVisibleSamples)
+        {
+            view_first_ = 0.0;
+            view_last_ = std::max(total, 1.0);
+            following_ = true;
+            return;
+        }
+
+        const double length = std::clamp(view_last_ - view_first_, kMinVisibleSamples, total);
+        view_first_ = std::clamp(view_first_, 0.0, total - length);
+        view_last_ = view_first_ + length;
+        following_ = view_last_ >= total;
+    }
+
+    void TimeSeriesPlot::UpdateYRange()
+    {
+        float low = 0.0f;
+        float high = 0.0f;
+        bool any = false;
+        for (const Series &entry : series_)
+        {
+            float series_low = 0.0f;
+            float series_high = 0.0f;
+            if (entry.series->GetBounds(view_first_, view_last_, series_low, series_high))
+            {
+                low = any ? std::min(low, series_low) : series_low;
+                high = any ? std::max(high, series_high) : series_high;
+                any = true;
+            }
+        }
+        if (!any)
+        {
+            return;
+        }
+        if (high - low <= 0.0f)
+        {
+            low -= 1.0f;
+            high += 1.0f;
+        }
+        const float margin = (high - low) * kYMargin;
+        y_min_ = low - margin;
+        y_max_ = high + margin;
+    }
+
+    void TimeSeriesPlot::RenderGpu(uint32_t width, uint32_t height)
+    {
+        target_->Resize(width, height);
+        target_->Bind();
+        target_->Clear(kBackground[0], kBackground[1], kBackground[2], kBackground[3]);
+
+        const GLboolean blend_was_enabled = glIsEnabled(GL_BLEND);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glUseProgram(program_);
+        glBindVertexArray(vertex_array_);
+        glUniform2f(viewport_location_, static_cast<float>(width), static_cast<float>(height));
+        glUniform2f(y_range_location_, y_min_, 2.0f / (y_max_ - y_min_));
+
+        const double length = view_last_ - view_first_;
+        const double samples_per_column = length / static_cast<double>(width);
+        for (size_t index = 0; index < series_.size(); ++index)
+        {
+            Series &entry = series_[index];
+            SyncBuffers(entry);
+            const TimeSeries &source = *entry.series;
+            if (source.GetSize() == 0)
+            {
+                continue;
+            }
+
+            // Samples as a strip once there are fewer than one per column
+            const bool strip = samples_per_column <= 1.0;
+            const size_t level = strip ? 0 : source.ChooseLevel(samples_per_column);
+            const double span = TimeSeries::GetLevelSpan(level);
+            const size_t level_size = source.GetLevelSize(level);
+            const double start = view_first_ / span;
+            const double first_element = strip ? std::floor(start) : std::floor(start) - 1.0;
+            const size_t first = static_cast<size_t>(std::max(first_element, 0.0));
+            if (first >= level_size)
+            {
+                continue;
+            }
+            if (index == 0)
+            {
+                stats_.level = level;
+            }
+
+            // Integer offsets keep float precision at any sample index
+            const size_t chunk_index = first / TimeSeries::kChunkSize;
+            const size_t base = first % TimeSeries::kChunkSize;
+            const size_t count = std::min(level_size - chunk_index * TimeSeries::kChunkSize - base,
+                                          2 * TimeSeries::kChunkSize - base);
+            const GpuLevel &gpu_level = entry.levels[level];
+            const GpuChunk &low = gpu_level.chunks[chunk_index];
+            const GpuChunk &high = chunk_index + 1 < gpu_level.chunks.size()
+                                       ? gpu_level.chunks[chunk_index + 1]
+                                       : low;
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, low.min_buffer);
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, high.min_buffer);
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2,
+                             level > 0 ? low.max_buffer : low.min_buffer);
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3,
+                             level > 0 ? high.max_buffer : high.min_buffer);
+
+            const ImVec4 color = ImGui::ColorConvertU32ToFloat4(entry.color);
+            glUniform4f(color_location_, color.x, color.y, color.z, color.w);
+            glUniform1i(base_location_, static_cast<GLint>(base));
+            glUniform1i(count_location_, static_cast<GLint>(count));
+            glUniform1f(phase_location_, static_cast<float>(start - static_cast<double>(first)));
+            if (strip)
+            {
+                const size_t last =
+                    std::min(static_cast<size_t>(std::ceil(view_last_)) + 1, level_size);
+                glUniform1i(mode_location_, 0);
+                glUniform1f(step_location_, static_cast<float>(2.0 / length));
+                glDrawArrays(GL_LINE_STRIP, 0,
+                             static_cast<GLsizei>(std::min(last - first, count)));
+            }
+            else
+            {
+                glUniform1i(mode_location_, 1);
+                glUniform1f(step_location_, static_cast<float>(samples_per_column / span));
+                glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(width * 2));
+            }
+        }
+
+        for (GLuint binding = 0; binding < 4; ++binding)
+        {
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+        }
+        glBindVertexArray(0);
+        glUseProgram(0);
+        if (!blend_was_enabled)
+        {
+            glDisable(GL_BLEND);
+        }
+        target_->Unbind();
+    }
+
+    void TimeSeriesPlot::DecimateCpu(uint32_t columns)
+    {
+        const double length = view_last_ - view_first_;
+        const double samples_per_column = length / static_cast<double>(columns);
+        for (size_t index = 0; index < series_.size(); ++index)
+        {
+            const TimeSeries &source = *series_[index].series;
+            CpuSeries &cpu = cpu_series_[index];
+            cpu.samples = samples_per_column <= 1.0;
+            if (cpu.samples)
+            {
+                const size_t size = source.GetSize();
+                const size_t first = std::min(static_cast<size_t>(view_first_), size);
+                const size_t last = std::min(static_cast<size_t>(std::ceil(view_last_)) + 1, size);
+                cpu.first_sample = static_cast<double>(first);
+                cpu.min.resize(last - first);
+                for (size_t i = first; i < last; ++i)
+                {
+                    cpu.min[i - first] = source.GetSample(i);
+                }
+                continue;
+            }
+
+            cpu.min.resize(columns);
+            cpu.max.resize(columns);
+            source.Decimate(view_first_, view_last_, columns, cpu.min.data(), cpu.max.data());
+            if (index == 0)
+            {
+                stats_.level = source.ChooseLevel(samples_per_column);
+            }
+        }
+    }
+
+    void TimeSeriesPlot::DrawCpu(ImDrawList *draw_list, const ImVec2 &origin,
+                                 const ImVec2 &size) const
+    {
+        const float y_scale = size.y / (y_max_ - y_min_);
+        auto to_y = [&](float value) { return origin.y + size.y - (value - y_min_) * y_scale; };
+        const double length = view_last_ - view_first_;
+
+        for (size_t index = 0; index < series_.size(); ++index)
+        {
+            const CpuSeries &cpu = cpu_series_[index];
+            const uint32_t color = series_[index].color;
+            if (cpu.samples)
+            {
+                const double x_scale = static_cast<double>(size.x) / length;
+                for (size_t i = 0; i < cpu.min.size(); ++i)
+                {
+                    const double x =
+                        (cpu.first_sample + static_cast<double>(i) - view_first_) * x_scale;
+                    draw_list->PathLineTo(
+                        ImVec2(origin.x + static_cast<float>(x), to_y(cpu.min[i])));
+                }
+                draw_list->PathStroke(color, ImDrawFlags_None, 1.0f);
+                continue;
+            }
+
+            for (size_t column = 0; column < cpu.min.size(); ++column)
+            {
+                if (cpu.min[column] > cpu.max[column])
+                {
+                    continue;
+                }
+                // Reach the previous column so steep edges stay connected
+                float low = cpu.min[column];
+                float high = cpu.max[column];
+                if (column > 0 && cpu.min[column - 1] <= cpu.max[column - 1])
+                {
+                    low = std::min(low, cpu.max[column - 1]);
+                    high = std::max(high, cpu.min[column - 1]);
+                }
+                const float x = origin.x + static_cast<float>(column) + 0.5f;
+                const float y0 = to_y(low);
+                const float y1 = std::min(to_y(high), y0 - 1.0f);
+                draw_list->AddLine(ImVec2(x, y0), ImVec2(x, y1), color);
+            }
+        }
+    }
+
+} // namespace flux
@@ -0,0 +1,170 @@
+// Copyright 2026 Beisent
+// ImGui plot widget for large TimeSeries
+
+#ifndef FLUX_CORE_SRC_TIMESERIESPLOT_HPP_
+#define FLUX_CORE_SRC_TIMESERIESPLOT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <imgui.h>
+
+#include "RenderTarget.hpp"
+#include "TimeSeries.hpp"
+
+namespace flux
+{
+
+    struct TimeSeriesPlotStats
+    {
+        bool gpu = false;        // Decimated by the vertex shader into a RenderTarget
+        uint64_t redraws = 0;    // Frames where the view, data or size changed
+        double redraw_ms = 0.0;  // CPU time of the last redraw, including uploads
+        uint64_t uploaded_bytes = 0;
+        size_t level = 0;        // Pyramid level drawn for the first series
+    };
+
+    // Plots TimeSeries of any length in O(pixels) per redraw. Each series' samples
+    // and min/max pyramid are mirrored into GPU buffers, appends upload only the
+    // new tail, and a vertex shader reduces the level matching the zoom to one
+    // vertical line per pixel column, or draws the samples as a line strip once
+    // there are fewer than one per column. The plot is rendered into a
+    // RenderTarget only when something changed. Without storage buffers in the
+    // vertex shader the same reduction runs on the CPU (TimeSeries::Decimate)
+    // and is drawn through ImDrawList.
+    //
+    // Mouse wheel zooms around the cursor, dragging pans, double click fits all
+    // samples. A view reaching the last sample follows new data. Create, draw and
+    // destroy on the GL thread while the application runs:
+    //
+    //     plot_.AddSeries(series_, IM_COL32(90, 170, 255, 255));
+    //     ...
+    //     series_.Append(samples.data(), samples.size());
+    //     plot_.Draw("##signal");
+    class TimeSeriesPlot
+    {
+    public:
+        TimeSeriesPlot() = default;
+        ~TimeSeriesPlot();
+
+        TimeSeriesPlot(const TimeSeriesPlot &) = delete;
+        TimeSeriesPlot &operator=(const TimeSeriesPlot &) = delete;
+
+        // The series must outlive the plot or be removed with ClearSeries()
+        void AddSeries(const TimeSeries &series, uint32_t color);
+        void ClearSeries();
+
+        // size <= 0 takes the available content region on that axis
+        void Draw(const char *id, const ImVec2 &size = ImVec2(0.0f, 0.0f));
+
+        // In samples, ends fit-all mode
+        void SetView(double first, double last);
+        void FitAll() { fit_all_ = true; }
+        [[nodiscard]] double GetViewFirst() const { return view_first_; }
+        [[nodiscard]] double GetViewLast() const { return view_last_; }
+
+        // Decimate on the CPU even where the GPU path is available
+        void SetForceCpu(bool force_cpu) { force_cpu_ = force_cpu; }
+        [[nodiscard]] const TimeSeriesPlotStats &GetStats() const { return stats_; }
+
+    private:
+        struct GpuChunk
+        {
+            uint32_t min_buffer = 0;
+            uint32_t max_buffer = 0; // Unused on level 0
+            size_t capacity = 0;     // Elements
+        };
+
+        struct GpuLevel
+        {
+            std::vector<GpuChunk> chunks;
+            size_t synced = 0;
+        };
+
+        struct Series
+        {
+            const TimeSeries *series = nullptr;
+            uint32_t color = 0;
+            uint64_t version = 0;
+            std::vector<GpuLevel> levels;
+        };
+
+        // What the last redraw showed
+        struct DrawnState
+        {
+            double first = 0.0;
+            double last = 0.0;
+            float y_min = 0.0f;
+            float y_max = 0.0f;
+            uint32_t width = 0;
+            uint32_t height = 0;
+            std::vector<size_t> sizes;
+            std::vector<uint64_t> versions;
+
+            bool operator==(const DrawnState &other) const;
+        };
+
+        enum class GpuState
+        {
+            Unknown,
+            Ready,
+            Unavailable
+        };
+
+        bool InitGpu();
+        void DestroyBuffers(Series &series);
+        void SyncBuffers(Series &series);
+        void Upload(Series &series, size_t level, size_t first, size_t last);
+
+        void HandleInput(const ImVec2 &origin, const ImVec2 &size, bool hovered, bool active);
+        void ClampView(double total);
+        void UpdateYRange();
+
+        void RenderGpu(uint32_t width, uint32_t height);
+        void DecimateCpu(uint32_t columns);
+        void DrawCpu(ImDrawList *draw_list, const ImVec2 &origin, const ImVec2 &size) const;
+
+        std::vector<Series> series_;
+
+        double view_first_ = 0.0;
+        double view_last_ = 1.0;
+        float y_min_ = 0.0f;
+        float y_max_ = 1.0f;
+        bool fit_all_ = true;
+        bool following_ = true;
+        bool force_cpu_ = false;
+
+        GpuState gpu_state_ = GpuState::Unknown;
+        uint32_t program_ = 0;
+        uint32_t vertex_array_ = 0;
+        int mode_location_ = -1;
+        int base_location_ = -1;
+        int count_location_ = -1;
+        int phase_location_ = -1;
+        int step_location_ = -1;
+        int viewport_location_ = -1;
+        int y_range_location_ = -1;
+        int color_location_ = -1;
+        std::unique_ptr<RenderTarget> target_;
+        bool drawn_gpu_ = false;
+        DrawnState drawn_;
+
+        // CPU path: per series min and max per column, or the visible samples
+        // when zoomed in past one per column
+        struct CpuSeries
+        {
+            std::vector<float> min;
+            std::vector<float> max;
+            double first_sample = 0.0;
+            bool samples = false;
+        };
+        std::vector<CpuSeries> cpu_series_;
+
+        TimeSeriesPlotStats stats_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_TIMESERIESPLOT_HPP_
@@ -10,15 +10,21 @@ namespace flux
     class TimeStep
     {
     public:
-        constexpr TimeStep(float time = 0.0f) : time_(time) {}
+        constexpr TimeStep(double time = 0.0) : time_(time) {}
 
-        constexpr operator float() const { return time_; }
+        constexpr operator float() const { return static_cast<float>(time_); }
 
-        [[nodiscard]] constexpr float GetSeconds() const { return time_; }
-        [[nodiscard]] constexpr float GetMilliseconds() const { return time_ * 1000.0f; }
+        [[nodiscard]] constexpr float GetSeconds() const { return static_cast<float>(time_); }
+        [[nodiscard]] constexpr float GetMilliseconds() const
+        {
+            return static_cast<float>(time_ * 1000.0);
+        }
+
+        // Full precision for accumulating simulation time over long uptimes
+        [[nodiscard]] constexpr double GetSecondsDouble() const { return time_; }
 
     private:
-        float time_;
+        double time_;
     };
 
 } // namespace flux
@@ -0,0 +1,152 @@
+// Copyright 2026 Beisent
+// Tracer implementation
+
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+namespace flux
+{
+
+    namespace
+    {
+        thread_local TraceBuffer *t_buffer = nullptr;
+
+        void WriteEscaped(std::FILE *file, const char *text)
+        {
+            for (; *text; ++text)
+            {
+                const char c = *text;
+                if (c == '"' || c == '\\')
+                {
+                    std::fputc('\\', file);
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    continue;
+                }
+                std::fputc(c, file);
+            }
+        }
+    } // namespace
+
+    void TraceBuffer::CopyEvents(int64_t since_ns, std::vector<TraceEvent> &out) const
+    {
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        const uint64_t first = head > kCapacity ? head - kCapacity : 0;
+        const size_t start = out.size();
+        for (uint64_t i = first; i < head; ++i)
+        {
+            out.push_back(events_[i & (kCapacity - 1)]);
+        }
+
+        // Slots the writer reached while we were copying hold newer, mismatched data,
+        // including the one it may be writing right now
+        const uint64_t head_after = head_.load(std::memory_order_acquire) + 1;
+        const uint64_t overwritten =
+            head_after > kCapacity + first ? head_after - kCapacity - first : 0;
+        const size_t keep_from = start + static_cast<size_t>(std::min<uint64_t>(
+                                             overwritten, out.size() - start));
+
+        auto last = std::remove_if(out.begin() + keep_from, out.end(),
+            [since_ns](const TraceEvent &event) { return event.end_ns < since_ns; });
+        out.erase(last, out.end());
+        out.erase(out.begin() + start, out.begin() + keep_from);
+    }
+
+    Tracer &Tracer::Get()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    TraceBuffer &Tracer::GetThreadBuffer()
+    {
+        if (!t_buffer)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto index = static_cast<uint32_t>(buffers_.size());
+            buffers_.push_back(
+                std::make_shared<TraceBuffer>(index, "Thread " + std::to_string(index)));
+            t_buffer = buffers_.back().get();
+        }
+        return *t_buffer;
+    }
+
+    const char *Tracer::Intern(std::string_view name)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return names_.emplace(name).first->c_str();
+    }
+
+    void Tracer::SetThreadName(std::string_view name)
+    {
+        TraceBuffer &buffer = GetThreadBuffer();
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer.SetThreadName(std::string(name));
+    }
+
+    bool Tracer::WriteChromeTrace(const std::string &path, double last_seconds) const
+    {
+        const int64_t since_ns =
+            last_seconds > 0.0 ? Now() - static_cast<int64_t>(last_seconds * 1e9)
+                               : std::numeric_limits<int64_t>::min();
+
+        std::vector<std::shared_ptr<TraceBuffer>> buffers;
+        std::vector<std::string> thread_names;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            buffers = buffers_;
+            for (const auto &buffer : buffers)
+            {
+                thread_names.push_back(buffer->GetThreadName());
+            }
+        }
+
+        std::vector<std::vector<TraceEvent>> events(buffers.size());
+        int64_t origin_ns = std::numeric_limits<int64_t>::max();
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            buffers[i]->CopyEvents(since_ns, events[i]);
+            for (const TraceEvent &event : events[i])
+            {
+                origin_ns = std::min(origin_ns, event.begin_ns);
+            }
+        }
+
+        std::FILE *file = std::fopen(path.c_str(), "w");
+        if (!file)
+        {
+            return false;
+        }
+
+        std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+        bool first = true;
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            std::fprintf(file,
+                         "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                         "\"args\":{\"name\":\"",
+                         first ? "" : ",\n", buffers[i]->GetThreadIndex());
+            WriteEscaped(file, thread_names[i].c_str());
+            std::fputs("\"}}", file);
+            first = false;
+
+            for (const TraceEvent &event : events[i])
+            {
+                std::fputs(",\n{\"name\":\"", file);
+                WriteEscaped(file, event.name ? event.name : "?");
+                std::fprintf(file, "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                             buffers[i]->GetThreadIndex(),
+                             static_cast<double>(event.begin_ns - origin_ns) / 1000.0,
+                             static_cast<double>(event.end_ns - event.begin_ns) / 1000.0);
+            }
+        }
+        std::fputs("\n]}\n", file);
+
+        return std::fclose(file) == 0;
+    }
+
+} // namespace flux
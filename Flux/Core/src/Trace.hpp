@@ -0,0 +1,144 @@
+// Copyright 2026 Beisent
+// Timeline tracing for Flux framework
+
+#ifndef FLUX_CORE_SRC_TRACE_HPP_
+#define FLUX_CORE_SRC_TRACE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace flux
+{
+
+    struct TraceEvent
+    {
+        const char *name = nullptr; // Static or interned, outlives the buffer
+        int64_t begin_ns = 0;
+        int64_t end_ns = 0;
+    };
+
+    // Fixed-size ring of the most recent events of one thread. Only the owning
+    // thread writes; readers copy and drop the slots that were overwritten while
+    // copying, same as FrameProfiler's history.
+    class TraceBuffer
+    {
+    public:
+        static constexpr size_t kCapacity = size_t(1) << 16;
+
+        TraceBuffer(uint32_t thread_index, std::string thread_name)
+            : events_(kCapacity), thread_index_(thread_index),
+              thread_name_(std::move(thread_name))
+        {
+        }
+
+        void Push(const TraceEvent &event)
+        {
+            const uint64_t head = head_.load(std::memory_order_relaxed);
+            events_[head & (kCapacity - 1)] = event;
+            head_.store(head + 1, std::memory_order_release);
+        }
+
+        // Appends the events that ended at or after since_ns, oldest first
+        void CopyEvents(int64_t since_ns, std::vector<TraceEvent> &out) const;
+
+        [[nodiscard]] uint32_t GetThreadIndex() const { return thread_index_; }
+        [[nodiscard]] const std::string &GetThreadName() const { return thread_name_; }
+        void SetThreadName(std::string name) { thread_name_ = std::move(name); }
+
+    private:
+        std::vector<TraceEvent> events_;
+        std::atomic<uint64_t> head_{0};
+        uint32_t thread_index_;
+        std::string thread_name_;
+    };
+
+    // Process-wide. Each thread gets its own buffer on its first event, the only
+    // lock on the recording path is taken there.
+    class Tracer
+    {
+    public:
+        static Tracer &Get();
+
+        [[nodiscard]] static int64_t Now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+        void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+        [[nodiscard]] bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+        void Record(const char *name, int64_t begin_ns, int64_t end_ns)
+        {
+            if (IsEnabled())
+            {
+                GetThreadBuffer().Push(TraceEvent{name, begin_ns, end_ns});
+            }
+        }
+
+        // Returns a pointer that stays valid for the lifetime of the process. Takes a
+        // lock, intern once rather than per event.
+        const char *Intern(std::string_view name);
+
+        void SetThreadName(std::string_view name);
+
+        // Chrome trace event JSON, loadable in chrome://tracing and Perfetto
+        bool WriteChromeTrace(const std::string &path, double last_seconds) const;
+
+    private:
+        Tracer() = default;
+
+        TraceBuffer &GetThreadBuffer();
+
+        std::atomic<bool> enabled_{true};
+
+        mutable std::mutex mutex_;
+        std::vector<std::shared_ptr<TraceBuffer>> buffers_;
+        std::unordered_set<std::string> names_;
+    };
+
+    class TraceScope
+    {
+    public:
+        explicit TraceScope(const char *name) : name_(name), begin_ns_(Tracer::Now()) {}
+        ~TraceScope() { Tracer::Get().Record(name_, begin_ns_, Tracer::Now()); }
+
+        TraceScope(const TraceScope &) = delete;
+        TraceScope &operator=(const TraceScope &) = delete;
+
+    private:
+        const char *name_;
+        int64_t begin_ns_;
+    };
+
+} // namespace flux
+
+#define FLUX_TRACE_CONCAT_INNER(a, b) a##b
+#define FLUX_TRACE_CONCAT(a, b) FLUX_TRACE_CONCAT_INNER(a, b)
+
+// Enabled with the FLUX_ENABLE_TRACING CMake option, otherwise the macros expand
+// to nothing and their arguments are not evaluated.
+#if defined(FLUX_ENABLE_TRACING)
+// name must outlive the trace: a string literal or a Tracer::Intern result
+#define FLUX_TRACE_SCOPE(name) \
+    ::flux::TraceScope FLUX_TRACE_CONCAT(flux_trace_scope_, __COUNTER__)(name)
+// Interns on every call, for rare spans with runtime names
+#define FLUX_TRACE_SCOPE_DYNAMIC(name) \
+    FLUX_TRACE_SCOPE(::flux::Tracer::Get().Intern(name))
+#define FLUX_TRACE_THREAD_NAME(name) ::flux::Tracer::Get().SetThreadName(name)
+#else
+#define FLUX_TRACE_SCOPE(name) ((void)0)
+#define FLUX_TRACE_SCOPE_DYNAMIC(name) ((void)0)
+#define FLUX_TRACE_THREAD_NAME(name) ((void)0)
+#endif
+
+#endif // FLUX_CORE_SRC_TRACE_HPP_
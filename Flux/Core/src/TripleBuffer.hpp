@@ -0,0 +1,58 @@
+// Copyright 2026 Beisent
+// Lock-free triple buffer for handing snapshots between threads
+
+#ifndef FLUX_CORE_SRC_TRIPLEBUFFER_HPP_
+#define FLUX_CORE_SRC_TRIPLEBUFFER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace flux
+{
+
+    // The producer fills GetWriteBuffer() and calls Publish(). The consumer calls
+    // Acquire() and reads GetReadBuffer(). Neither side ever blocks, the consumer
+    // always sees the most recently published snapshot.
+    template <typename T>
+    class TripleBuffer
+    {
+    public:
+        [[nodiscard]] T &GetWriteBuffer() { return buffers_[write_index_]; }
+
+        void Publish()
+        {
+            const uint8_t previous =
+                middle_.exchange(static_cast<uint8_t>(write_index_ | kFreshBit),
+                                 std::memory_order_acq_rel);
+            write_index_ = previous & kIndexMask;
+        }
+
+        // Returns true when a new snapshot became readable
+        bool Acquire()
+        {
+            if (!(middle_.load(std::memory_order_relaxed) & kFreshBit))
+            {
+                return false;
+            }
+            const uint8_t previous =
+                middle_.exchange(read_index_, std::memory_order_acq_rel);
+            read_index_ = previous & kIndexMask;
+            return true;
+        }
+
+        [[nodiscard]] const T &GetReadBuffer() const { return buffers_[read_index_]; }
+
+    private:
+        static constexpr uint8_t kIndexMask = 0x3;
+        static constexpr uint8_t kFreshBit = 0x4;
+
+        std::array<T, 3> buffers_{};
+        uint8_t write_index_ = 0;
+        std::atomic<uint8_t> middle_{1};
+        uint8_t read_index_ = 2;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_TRIPLEBUFFER_HPP_
@@ -0,0 +1,176 @@
+// Copyright 2026 Beisent
+// ViewportRenderer implementation
+
+#include "ViewportRenderer.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <GLFW/glfw3.h>
+
+#include "FrameCache.hpp"
+
+namespace flux
+{
+
+    namespace
+    {
+        // GLFW callbacks carry no user data that ImGui's backend does not already use
+        ViewportRenderer *s_viewport_renderer = nullptr;
+
+        double ElapsedMilliseconds(std::chrono::steady_clock::time_point start,
+                                   std::chrono::steady_clock::time_point end)
+        {
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        }
+    } // namespace
+
+    ViewportRenderer::~ViewportRenderer()
+    {
+        Shutdown();
+    }
+
+    void ViewportRenderer::Shutdown()
+    {
+        if (s_viewport_renderer == this)
+        {
+            s_viewport_renderer = nullptr;
+        }
+        windows_.clear();
+        stats_ = ViewportRendererStats();
+    }
+
+    ViewportRenderer::Window &ViewportRenderer::GetWindow(const ImGuiViewport &viewport)
+    {
+        auto it = std::find_if(windows_.begin(), windows_.end(), [&](const Window &window)
+                               { return window.id == viewport.ID; });
+        if (it == windows_.end())
+        {
+            Window window;
+            window.id = viewport.ID;
+            windows_.push_back(window);
+            return windows_.back();
+        }
+        return *it;
+    }
+
+    void ViewportRenderer::OnRefresh(void *handle)
+    {
+        if (!s_viewport_renderer)
+        {
+            return;
+        }
+        for (Window &window : s_viewport_renderer->windows_)
+        {
+            if (window.handle == handle)
+            {
+                window.hash = FrameCache::kUncacheable;
+            }
+        }
+    }
+
+    void ViewportRenderer::Render(bool drawn_outside_imgui)
+    {
+        using Clock = std::chrono::steady_clock;
+        s_viewport_renderer = this;
+
+        const Clock::time_point frame_start = Clock::now();
+        stats_.rendered = 0;
+        stats_.hidden = 0;
+        stats_.unchanged = 0;
+        stats_.viewports.clear();
+        for (Window &window : windows_)
+        {
+            window.seen = false;
+        }
+
+        ImGuiPlatformIO &platform_io = ImGui::GetPlatformIO();
+        // Viewport 0 is the main window, drawn and swapped by the application
+        for (int i = 1; i < platform_io.Viewports.Size; ++i)
+        {
+            ImGuiViewport *viewport = platform_io.Viewports[i];
+            auto *handle = static_cast<GLFWwindow *>(viewport->PlatformHandle);
+            Window &window = GetWindow(*viewport);
+            window.seen = true;
+
+            ViewportRenderStats viewport_stats;
+            viewport_stats.id = viewport->ID;
+
+            int width = 0;
+            int height = 0;
+            if (handle)
+            {
+                glfwGetFramebufferSize(handle, &width, &height);
+            }
+            if (!handle || (viewport->Flags & ImGuiViewportFlags_IsMinimized) ||
+                glfwGetWindowAttrib(handle, GLFW_ICONIFIED) ||
+                !glfwGetWindowAttrib(handle, GLFW_VISIBLE) || width <= 0 || height <= 0)
+            {
+                // Whatever it shows is stale once it comes back
+                window.hash = FrameCache::kUncacheable;
+                viewport_stats.result = ViewportRenderResult::Hidden;
+                stats_.viewports.push_back(viewport_stats);
+                ++stats_.hidden;
+                continue;
+            }
+
+            // A recreated platform window starts out with nothing in it
+            const bool new_window = window.handle != handle;
+            uint64_t hash = FrameCache::kUncacheable;
+            if (skip_unchanged_ && viewport->DrawData && !new_window && !drawn_outside_imgui)
+            {
+                uint64_t hashed_bytes = 0;
+                hash = HashDrawData(*viewport->DrawData, hashed_bytes);
+                if (hash != FrameCache::kUncacheable && hash == window.hash)
+                {
+                    viewport_stats.result = ViewportRenderResult::Unchanged;
+                    stats_.viewports.push_back(viewport_stats);
+                    ++stats_.unchanged;
+                    continue;
+                }
+            }
+
+            const Clock::time_point render_start = Clock::now();
+            if (platform_io.Platform_RenderWindow)
+            {
+                platform_io.Platform_RenderWindow(viewport, nullptr);
+            }
+            if (new_window)
+            {
+                // Per context: only the main window's swap may wait for vsync
+                glfwMakeContextCurrent(handle);
+                glfwSwapInterval(0);
+                glfwSetWindowRefreshCallback(handle,
+                    [](GLFWwindow *refreshed) { OnRefresh(refreshed); });
+                window.handle = handle;
+            }
+            if (platform_io.Renderer_RenderWindow)
+            {
+                platform_io.Renderer_RenderWindow(viewport, nullptr);
+            }
+
+            const Clock::time_point swap_start = Clock::now();
+            if (platform_io.Platform_SwapBuffers)
+            {
+                platform_io.Platform_SwapBuffers(viewport, nullptr);
+            }
+            if (platform_io.Renderer_SwapBuffers)
+            {
+                platform_io.Renderer_SwapBuffers(viewport, nullptr);
+            }
+            const Clock::time_point swap_end = Clock::now();
+
+            window.hash = hash;
+            viewport_stats.render_ms = ElapsedMilliseconds(render_start, swap_start);
+            viewport_stats.swap_ms = ElapsedMilliseconds(swap_start, swap_end);
+            stats_.viewports.push_back(viewport_stats);
+            ++stats_.rendered;
+        }
+
+        windows_.erase(std::remove_if(windows_.begin(), windows_.end(),
+                                      [](const Window &window) { return !window.seen; }),
+                       windows_.end());
+        stats_.total_ms = ElapsedMilliseconds(frame_start, Clock::now());
+    }
+
+} // namespace flux
@@ -0,0 +1,84 @@
+// Copyright 2026 Beisent
+// Rendering of secondary ImGui viewport windows for Flux framework
+
+#ifndef FLUX_CORE_SRC_VIEWPORTRENDERER_HPP_
+#define FLUX_CORE_SRC_VIEWPORTRENDERER_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include <imgui.h>
+
+namespace flux
+{
+
+    enum class ViewportRenderResult : uint8_t
+    {
+        Rendered,
+        Hidden,   // Minimized, invisible or zero-sized, not drawn or swapped
+        Unchanged // Same draw data as the frame the window shows, not drawn or swapped
+    };
+
+    struct ViewportRenderStats
+    {
+        uint32_t id = 0; // ImGuiID of the viewport
+        ViewportRenderResult result = ViewportRenderResult::Rendered;
+        double render_ms = 0.0; // Context switch and draw
+        double swap_ms = 0.0;
+    };
+
+    struct ViewportRendererStats
+    {
+        uint32_t rendered = 0;
+        uint32_t hidden = 0;
+        uint32_t unchanged = 0;
+        double total_ms = 0.0;
+        std::vector<ViewportRenderStats> viewports; // Every secondary viewport, last frame
+    };
+
+    // Replaces ImGui::RenderPlatformWindowsDefault(). Each secondary viewport window
+    // gets swap interval 0 when it is first drawn, so only the main window waits for
+    // vsync and several floating windows no longer divide the frame rate. Minimized,
+    // invisible and zero-sized windows are skipped. With SetSkipUnchanged(), a window
+    // whose draw data hashes the same as the frame it already shows is neither drawn
+    // nor swapped, and costs no context switch; it is drawn again when GLFW asks for
+    // a refresh. Call after ImGui::UpdatePlatformWindows(), GL thread only. The
+    // caller restores its own context afterwards.
+    class ViewportRenderer
+    {
+    public:
+        ViewportRenderer() = default;
+        ~ViewportRenderer();
+
+        ViewportRenderer(const ViewportRenderer &) = delete;
+        ViewportRenderer &operator=(const ViewportRenderer &) = delete;
+
+        void SetSkipUnchanged(bool skip_unchanged) { skip_unchanged_ = skip_unchanged; }
+
+        // drawn_outside_imgui: textures may have changed without the draw data
+        // changing, so every window is drawn
+        void Render(bool drawn_outside_imgui);
+        void Shutdown();
+
+        [[nodiscard]] const ViewportRendererStats &GetStats() const { return stats_; }
+
+    private:
+        struct Window
+        {
+            uint32_t id = 0;
+            void *handle = nullptr; // GLFWwindow
+            uint64_t hash = 0;      // Of the draw data the window shows
+            bool seen = false;
+        };
+
+        [[nodiscard]] Window &GetWindow(const ImGuiViewport &viewport);
+        static void OnRefresh(void *handle);
+
+        bool skip_unchanged_ = false;
+        std::vector<Window> windows_;
+        ViewportRendererStats stats_;
+    };
+
+} // namespace flux
+
+#endif // FLUX_CORE_SRC_VIEWPORTRENDERER_HPP_
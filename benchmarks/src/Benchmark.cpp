@@ -0,0 +1,259 @@
+// Copyright 2026 Beisent
+// Benchmark harness implementation
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+#include <glad/glad.h>
+
+namespace flux
+{
+
+    namespace
+    {
+        // Topmost overlay: its OnRenderUI runs once per frame, after every other layer
+        class FrameRecorderLayer : public Layer
+        {
+        public:
+            FrameRecorderLayer(Application &app, const BenchmarkConfig &config,
+                               BenchmarkResult &result)
+                : Layer("FrameRecorder"), app_(app), config_(config), result_(result)
+            {
+            }
+
+            void OnAttach() override
+            {
+                if (const GLubyte *renderer = glGetString(GL_RENDERER))
+                {
+                    result_.renderer = reinterpret_cast<const char *>(renderer);
+                }
+                frame_times_.reserve(config_.measured_frames);
+                allocations_.reserve(config_.measured_frames);
+                bytes_.reserve(config_.measured_frames);
+            }
+
+            void OnRenderUI() override
+            {
+                const double now = app_.GetTime();
+                const AllocationCounts counts = AllocationTracker::GetTotals();
+                if (frame_ > config_.warmup_frames)
+                {
+                    frame_times_.push_back((now - last_time_) * 1000.0);
+                    allocations_.push_back(
+                        static_cast<double>(counts.allocations - last_counts_.allocations));
+                    bytes_.push_back(static_cast<double>(counts.bytes - last_counts_.bytes));
+                }
+                last_time_ = now;
+                last_counts_ = counts;
+                ++frame_;
+            }
+
+            void OnDetach() override
+            {
+                result_.frames = static_cast<uint32_t>(frame_times_.size());
+                result_.frame_ms = BenchmarkDistribution::Compute(frame_times_);
+                result_.allocations_per_frame = BenchmarkDistribution::Compute(allocations_);
+                result_.allocated_bytes_per_frame = BenchmarkDistribution::Compute(bytes_);
+                if (config_.raw_frame_times)
+                {
+                    result_.frame_times_ms = frame_times_;
+                }
+
+                result_.coalesced_events = app_.GetCoalescedEventCount();
+                const TextureManagerStats &textures = app_.GetTextureStats();
+                result_.texture_uploaded_bytes = textures.uploaded_bytes_total;
+                result_.resident_textures = textures.resident_textures;
+            }
+
+        private:
+            Application &app_;
+            const BenchmarkConfig &config_;
+            BenchmarkResult &result_;
+
+            uint32_t frame_ = 0;
+            double last_time_ = 0.0;
+            AllocationCounts last_counts_;
+            std::vector<double> frame_times_;
+            std::vector<double> allocations_;
+            std::vector<double> bytes_;
+        };
+
+        void WriteEscaped(std::FILE *file, const std::string &text)
+        {
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    std::fputc('\\', file);
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    continue;
+                }
+                std::fputc(c, file);
+            }
+        }
+
+        void WriteDistribution(std::FILE *file, const char *name,
+                               const BenchmarkDistribution &distribution)
+        {
+            std::fprintf(file,
+                         "      \"%s\": {\"min\": %.4f, \"mean\": %.4f, \"p50\": %.4f, "
+                         "\"p90\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f, "
+                         "\"stddev\": %.4f},\n",
+                         name, distribution.min, distribution.mean, distribution.p50,
+                         distribution.p90, distribution.p95, distribution.p99, distribution.max,
+                         distribution.stddev);
+        }
+    } // namespace
+
+    BenchmarkDistribution BenchmarkDistribution::Compute(std::vector<double> samples)
+    {
+        BenchmarkDistribution distribution;
+        if (samples.empty())
+        {
+            return distribution;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        // Nearest rank, so every reported value is an observed sample
+        auto percentile = [&samples](double fraction)
+        {
+            const size_t rank = static_cast<size_t>(
+                std::ceil(fraction * static_cast<double>(samples.size())));
+            return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+        };
+
+        const double sum = std::accumulate(samples.begin(), samples.end(), 0.0);
+        distribution.mean = sum / static_cast<double>(samples.size());
+        double variance = 0.0;
+        for (double sample : samples)
+        {
+            variance += (sample - distribution.mean) * (sample - distribution.mean);
+        }
+        distribution.stddev = std::sqrt(variance / static_cast<double>(samples.size()));
+
+        distribution.min = samples.front();
+        distribution.max = samples.back();
+        distribution.p50 = percentile(0.50);
+        distribution.p90 = percentile(0.90);
+        distribution.p95 = percentile(0.95);
+        distribution.p99 = percentile(0.99);
+        return distribution;
+    }
+
+    BenchmarkResult RunBenchmark(const BenchmarkScenario &scenario,
+                                 const BenchmarkConfig &config)
+    {
+        BenchmarkResult result;
+        result.name = scenario.name;
+        result.description = scenario.description;
+
+        ApplicationSpecification spec;
+        spec.name = "FluxBenchmarks - " + scenario.name;
+        spec.width = config.width;
+        spec.height = config.height;
+        spec.headless = true;
+        spec.vsync = false;
+        spec.profiler_overlay = false;
+        // Without --output stdout carries the JSON, nothing else may print there
+        spec.log_startup_stats = false;
+        // One extra frame: the first has no predecessor to measure against
+        spec.max_frames = static_cast<uint64_t>(config.warmup_frames) + config.measured_frames + 1;
+        if (scenario.configure)
+        {
+            scenario.configure(spec);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        {
+            auto app = std::make_unique<Application>(spec);
+            if (!app->GetNativeWindow())
+            {
+                std::fprintf(stderr, "[Flux] Benchmark %s: no GL context\n",
+                             scenario.name.c_str());
+                return result;
+            }
+
+            if (scenario.setup)
+            {
+                scenario.setup(*app, result);
+            }
+            app->PushOverlay(std::make_unique<FrameRecorderLayer>(*app, config, result));
+            app->Run();
+        }
+        result.wall_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    bool WriteBenchmarkJson(const std::string &path, const BenchmarkConfig &config,
+                            const std::vector<BenchmarkResult> &results)
+    {
+        std::FILE *file = path.empty() ? stdout : std::fopen(path.c_str(), "w");
+        if (!file)
+        {
+            return false;
+        }
+
+        std::fprintf(file,
+                     "{\n  \"config\": {\"warmup_frames\": %u, \"measured_frames\": %u, "
+                     "\"width\": %u, \"height\": %u},\n  \"scenarios\": [\n",
+                     config.warmup_frames, config.measured_frames, config.width, config.height);
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const BenchmarkResult &result = results[i];
+            std::fputs("    {\n      \"name\": \"", file);
+            WriteEscaped(file, result.name);
+            std::fputs("\",\n      \"description\": \"", file);
+            WriteEscaped(file, result.description);
+            std::fputs("\",\n      \"renderer\": \"", file);
+            WriteEscaped(file, result.renderer);
+            std::fprintf(file, "\",\n      \"frames\": %u,\n      \"wall_seconds\": %.3f,\n",
+                         result.frames, result.wall_seconds);
+
+            WriteDistribution(file, "frame_ms", result.frame_ms);
+            WriteDistribution(file, "allocations_per_frame", result.allocations_per_frame);
+            WriteDistribution(file, "allocated_bytes_per_frame",
+                              result.allocated_bytes_per_frame);
+
+            if (!result.frame_times_ms.empty())
+            {
+                std::fputs("      \"frame_times_ms\": [", file);
+                for (size_t frame = 0; frame < result.frame_times_ms.size(); ++frame)
+                {
+                    std::fprintf(file, "%s%.4f", frame ? ", " : "", result.frame_times_ms[frame]);
+                }
+                std::fputs("],\n", file);
+            }
+            for (const auto &[name, distribution] : result.metrics)
+            {
+                WriteDistribution(file, name.c_str(), distribution);
+            }
+
+            std::fprintf(file,
+                         "      \"coalesced_events\": %llu,\n"
+                         "      \"texture_uploaded_bytes\": %llu,\n"
+                         "      \"resident_textures\": %u\n    }%s\n",
+                         static_cast<unsigned long long>(result.coalesced_events),
+                         static_cast<unsigned long long>(result.texture_uploaded_bytes),
+                         result.resident_textures, i + 1 < results.size() ? "," : "");
+        }
+        std::fputs("  ]\n}\n", file);
+
+        if (file == stdout)
+        {
+            return std::fflush(file) == 0;
+        }
+        return std::fclose(file) == 0;
+    }
+
+} // namespace flux
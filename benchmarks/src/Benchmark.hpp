@@ -0,0 +1,86 @@
+// Copyright 2026 Beisent
+// Headless frame-time benchmark harness for Flux
+
+#ifndef BENCHMARKS_SRC_BENCHMARK_HPP_
+#define BENCHMARKS_SRC_BENCHMARK_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Application.hpp"
+
+namespace flux
+{
+
+    struct BenchmarkConfig
+    {
+        uint32_t warmup_frames = 60;
+        uint32_t measured_frames = 600;
+        uint32_t width = 1280;
+        uint32_t height = 720;
+        bool raw_frame_times = false; // Also write every frame time to the JSON
+    };
+
+    struct BenchmarkResult;
+
+    // A reproducible workload: configure tweaks the specification, setup pushes the
+    // layers, which may add their own metrics to the result. Input must be scripted
+    // and deterministic, never time-based.
+    struct BenchmarkScenario
+    {
+        std::string name;
+        std::string description;
+        std::function<void(ApplicationSpecification &)> configure;
+        std::function<void(Application &, BenchmarkResult &)> setup;
+    };
+
+    struct BenchmarkDistribution
+    {
+        double min = 0.0;
+        double mean = 0.0;
+        double p50 = 0.0;
+        double p90 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+        double stddev = 0.0;
+
+        static BenchmarkDistribution Compute(std::vector<double> samples);
+    };
+
+    struct BenchmarkResult
+    {
+        std::string name;
+        std::string description;
+        std::string renderer;
+        uint32_t frames = 0;
+        double wall_seconds = 0.0;
+
+        BenchmarkDistribution frame_ms;
+        BenchmarkDistribution allocations_per_frame;
+        BenchmarkDistribution allocated_bytes_per_frame;
+        std::vector<double> frame_times_ms;
+
+        // Scenario-specific, e.g. per-frame append time of the plot scenarios
+        std::vector<std::pair<std::string, BenchmarkDistribution>> metrics;
+
+        uint64_t coalesced_events = 0;
+        uint64_t texture_uploaded_bytes = 0;
+        uint32_t resident_textures = 0;
+    };
+
+    [[nodiscard]] std::vector<BenchmarkScenario> CreateBenchmarkScenarios();
+
+    // Runs the scenario in a headless application, one Application per call
+    [[nodiscard]] BenchmarkResult RunBenchmark(const BenchmarkScenario &scenario,
+                                               const BenchmarkConfig &config);
+
+    bool WriteBenchmarkJson(const std::string &path, const BenchmarkConfig &config,
+                            const std::vector<BenchmarkResult> &results);
+
+} // namespace flux
+
+#endif // BENCHMARKS_SRC_BENCHMARK_HPP_
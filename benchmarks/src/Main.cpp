@@ -0,0 +1,128 @@
+// Copyright 2026 Beisent
+// FluxBenchmarks entry point
+//
+// Usage: FluxBenchmarks [--output results.json] [--filter name[,name...]]
+//                       [--frames N] [--warmup N] [--raw] [--list]
+//
+// Without --output the JSON goes to stdout; progress and diagnostics go to stderr.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+namespace
+{
+    bool MatchesFilter(const std::string &name, const std::string &filter)
+    {
+        if (filter.empty())
+        {
+            return true;
+        }
+
+        size_t begin = 0;
+        while (begin <= filter.size())
+        {
+            const size_t end = std::min(filter.find(',', begin), filter.size());
+            if (filter.compare(begin, end - begin, name) == 0)
+            {
+                return true;
+            }
+            begin = end + 1;
+        }
+        return false;
+    }
+} // namespace
+
+// Defines its own main: Core's EntryPoint (and CreateApplication) is not linked in
+int main(int argc, char **argv)
+{
+    flux::BenchmarkConfig config;
+    std::string output_path;
+    std::string filter;
+    bool list = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--output") == 0 && has_value)
+        {
+            output_path = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--filter") == 0 && has_value)
+        {
+            filter = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--frames") == 0 && has_value)
+        {
+            config.measured_frames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (std::strcmp(argv[i], "--warmup") == 0 && has_value)
+        {
+            config.warmup_frames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (std::strcmp(argv[i], "--raw") == 0)
+        {
+            config.raw_frame_times = true;
+        }
+        else if (std::strcmp(argv[i], "--list") == 0)
+        {
+            list = true;
+        }
+        else
+        {
+            std::fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    if (!flux::AllocationTracker::IsEnabled())
+    {
+        std::fprintf(stderr, "[Flux] Built without FLUX_TRACK_ALLOCATIONS, "
+                             "allocation counts will be zero\n");
+    }
+
+    const std::vector<flux::BenchmarkScenario> scenarios = flux::CreateBenchmarkScenarios();
+    std::vector<flux::BenchmarkResult> results;
+    bool all_ran = true;
+
+    for (const flux::BenchmarkScenario &scenario : scenarios)
+    {
+        if (!MatchesFilter(scenario.name, filter))
+        {
+            continue;
+        }
+        if (list)
+        {
+            std::printf("%-16s %s\n", scenario.name.c_str(), scenario.description.c_str());
+            continue;
+        }
+
+        flux::BenchmarkResult result = flux::RunBenchmark(scenario, config);
+        if (result.frames == 0)
+        {
+            all_ran = false;
+        }
+        std::fprintf(stderr,
+                     "[Flux] %-16s p50 %7.3f ms  p99 %7.3f ms  max %7.3f ms  %8.1f allocs/frame\n",
+                     result.name.c_str(), result.frame_ms.p50, result.frame_ms.p99,
+                     result.frame_ms.max, result.allocations_per_frame.mean);
+        results.push_back(std::move(result));
+    }
+
+    if (list)
+    {
+        return 0;
+    }
+    if (!flux::WriteBenchmarkJson(output_path, config, results))
+    {
+        std::fprintf(stderr, "[Flux] Failed to write %s\n", output_path.c_str());
+        return 1;
+    }
+    return all_ran ? 0 : 1;
+}
@@ -0,0 +1,512 @@
+// Copyright 2026 Beisent
+// Benchmark scenarios: widgets, layers, event floods, docking, textures, plots
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <imgui.h>
+
+#include "TimeSeries.hpp"
+#include "TimeSeriesPlot.hpp"
+
+namespace flux
+{
+
+    namespace
+    {
+        void FillMainViewport()
+        {
+            const ImGuiViewport *viewport = ImGui::GetMainViewport();
+            ImGui::SetNextWindowPos(viewport->WorkPos);
+            ImGui::SetNextWindowSize(viewport->WorkSize);
+        }
+
+        // Thousands of mixed widgets in one window
+        class WidgetsLayer : public Layer
+        {
+        public:
+            explicit WidgetsLayer(int count)
+                : Layer("Widgets"), count_(count), checked_(count), values_(count)
+            {
+            }
+
+            void OnRenderUI() override
+            {
+                FillMainViewport();
+                ImGui::Begin("Widgets", nullptr, ImGuiWindowFlags_NoSavedSettings);
+                for (int i = 0; i < count_; ++i)
+                {
+                    ImGui::PushID(i);
+                    switch (i % 5)
+                    {
+                    case 0:
+                        ImGui::Text("Item %d: %.3f", i, values_[i]);
+                        break;
+                    case 1:
+                        ImGui::Button("Button");
+                        break;
+                    case 2:
+                    {
+                        bool checked = checked_[i] != 0;
+                        ImGui::Checkbox("Check", &checked);
+                        checked_[i] = checked ? 1 : 0;
+                        break;
+                    }
+                    case 3:
+                        ImGui::SliderFloat("Slider", &values_[i], 0.0f, 1.0f);
+                        break;
+                    default:
+                        ImGui::ProgressBar(static_cast<float>(i % 100) / 100.0f);
+                        break;
+                    }
+                    ImGui::PopID();
+                }
+                ImGui::End();
+            }
+
+        private:
+            int count_;
+            std::vector<uint8_t> checked_;
+            std::vector<float> values_;
+        };
+
+        // One of many small layers, each with a little update work and a window
+        class SmallLayer : public Layer
+        {
+        public:
+            explicit SmallLayer(int index)
+                : Layer("Layer" + std::to_string(index)), index_(index)
+            {
+                SetEventCategoryMask(EventCategoryMouse);
+            }
+
+            void OnUpdate(TimeStep ts) override
+            {
+                for (int i = 0; i < 64; ++i)
+                {
+                    accumulator_ += std::sin(accumulator_ + static_cast<float>(i));
+                }
+            }
+
+            void OnEvent(Event &event) override { ++events_; }
+
+            void OnRenderUI() override
+            {
+                const float x = static_cast<float>(index_ % 16) * 80.0f;
+                const float y = static_cast<float>(index_ / 16) * 44.0f;
+                ImGui::SetNextWindowPos(ImVec2(x, y), ImGuiCond_FirstUseEver);
+                ImGui::SetNextWindowSize(ImVec2(78.0f, 42.0f), ImGuiCond_FirstUseEver);
+                ImGui::Begin(GetName().c_str(), nullptr,
+                             ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoDecoration);
+                ImGui::Text("%.2f %u", accumulator_, events_);
+                ImGui::End();
+            }
+
+        private:
+            int index_;
+            float accumulator_ = 0.0f;
+            uint32_t events_ = 0;
+        };
+
+        // Posts a deterministic burst of input every frame, larger than the event queue
+        class InputFloodLayer : public Layer
+        {
+        public:
+            InputFloodLayer(Application &app, int events_per_frame)
+                : Layer("InputFlood"), app_(app), events_per_frame_(events_per_frame)
+            {
+            }
+
+            void OnUpdate(TimeStep ts) override
+            {
+                for (int i = 0; i < events_per_frame_; ++i)
+                {
+                    const float t = static_cast<float>(frame_ * events_per_frame_ + i) * 0.001f;
+                    // Scrolls break up runs of moves, so not everything coalesces
+                    if (i % 16 == 15)
+                    {
+                        app_.PostEvent(MouseScrolledEvent(0.0f, 1.0f));
+                    }
+                    else
+                    {
+                        app_.PostEvent(MouseMovedEvent(640.0f + 600.0f * std::sin(t * 3.0f),
+                                                       360.0f + 340.0f * std::sin(t * 2.0f)));
+                    }
+                }
+                ++frame_;
+            }
+
+        private:
+            Application &app_;
+            int events_per_frame_;
+            uint64_t frame_ = 0;
+        };
+
+        // Windows docked as tabs into the application dockspace, plus floating ones
+        class DockedWindowsLayer : public Layer
+        {
+        public:
+            DockedWindowsLayer(int docked, int floating)
+                : Layer("DockedWindows"), docked_(docked), floating_(floating), samples_(1024)
+            {
+            }
+
+            void OnUpdate(TimeStep ts) override
+            {
+                for (size_t i = 0; i < samples_.size(); ++i)
+                {
+                    samples_[i] = std::sin(static_cast<float>(i + frame_) * 0.05f);
+                }
+                ++frame_;
+            }
+
+            void OnRenderUI() override
+            {
+                // Same id as the dockspace: layers render inside its host window
+                const ImGuiID dockspace_id = ImGui::GetID("MainDockSpace");
+                for (int i = 0; i < docked_ + floating_; ++i)
+                {
+                    char title[32];
+                    std::snprintf(title, sizeof(title), "Panel %d", i);
+                    if (i < docked_)
+                    {
+                        ImGui::SetNextWindowDockID(dockspace_id, ImGuiCond_FirstUseEver);
+                    }
+                    else
+                    {
+                        const float offset = static_cast<float>(i - docked_) * 40.0f;
+                        ImGui::SetNextWindowPos(ImVec2(100.0f + offset, 100.0f + offset),
+                                                ImGuiCond_FirstUseEver);
+                        ImGui::SetNextWindowSize(ImVec2(400.0f, 300.0f), ImGuiCond_FirstUseEver);
+                    }
+
+                    ImGui::Begin(title, nullptr, ImGuiWindowFlags_NoSavedSettings);
+                    ImGui::PlotLines("Signal", samples_.data(), static_cast<int>(samples_.size()),
+                                     0, nullptr, -1.0f, 1.0f, ImVec2(0.0f, 80.0f));
+                    if (ImGui::BeginTable("Table", 3, ImGuiTableFlags_Borders))
+                    {
+                        for (int row = 0; row < 32; ++row)
+                        {
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%d", row);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.3f", samples_[row]);
+                            ImGui::TableNextColumn();
+                            ImGui::TextUnformatted("value");
+                        }
+                        ImGui::EndTable();
+                    }
+                    ImGui::End();
+                }
+            }
+
+        private:
+            int docked_;
+            int floating_;
+            std::vector<float> samples_;
+            uint64_t frame_ = 0;
+        };
+
+        // Uncompressed 32-bit TGA, which stb_image reads without a PNG encoder here
+        bool WriteTga(const std::filesystem::path &path, int size, int seed)
+        {
+            uint8_t header[18] = {};
+            header[2] = 2; // Uncompressed true color
+            header[12] = static_cast<uint8_t>(size & 0xFF);
+            header[13] = static_cast<uint8_t>(size >> 8);
+            header[14] = static_cast<uint8_t>(size & 0xFF);
+            header[15] = static_cast<uint8_t>(size >> 8);
+            header[16] = 32;
+            header[17] = 0x28; // Top-left origin, 8 alpha bits
+
+            std::vector<uint8_t> pixels(static_cast<size_t>(size) * size * 4);
+            for (int y = 0; y < size; ++y)
+            {
+                for (int x = 0; x < size; ++x)
+                {
+                    uint8_t *pixel = &pixels[(static_cast<size_t>(y) * size + x) * 4];
+                    pixel[0] = static_cast<uint8_t>(x * 2 + seed * 7);
+                    pixel[1] = static_cast<uint8_t>(y * 2 + seed * 13);
+                    pixel[2] = static_cast<uint8_t>((x ^ y) + seed);
+                    pixel[3] = 255;
+                }
+            }
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(header), sizeof(header));
+            file.write(reinterpret_cast<const char *>(pixels.data()),
+                       static_cast<std::streamsize>(pixels.size()));
+            return static_cast<bool>(file);
+        }
+
+        // A grid of distinct images streamed through the texture manager
+        class TextureGridLayer : public Layer
+        {
+        public:
+            TextureGridLayer(Application &app, int columns, int texture_size)
+                : Layer("TextureGrid"), app_(app), columns_(columns), texture_size_(texture_size)
+            {
+            }
+
+            void OnAttach() override
+            {
+                const std::filesystem::path directory =
+                    std::filesystem::temp_directory_path() / "flux_benchmarks";
+                std::error_code error;
+                std::filesystem::create_directories(directory, error);
+
+                for (int i = 0; i < columns_ * columns_; ++i)
+                {
+                    const std::filesystem::path path =
+                        directory / ("texture_" + std::to_string(texture_size_) + "_" +
+                                     std::to_string(i) + ".tga");
+                    if (!std::filesystem::exists(path, error))
+                    {
+                        WriteTga(path, texture_size_, i);
+                    }
+                    textures_.push_back(app_.GetTextureManager().Load(path.string()));
+                }
+            }
+
+            void OnDetach() override { textures_.clear(); }
+
+            void OnRenderUI() override
+            {
+                FillMainViewport();
+                ImGui::Begin("Textures", nullptr, ImGuiWindowFlags_NoSavedSettings);
+                const float cell = ImGui::GetContentRegionAvail().x / static_cast<float>(columns_);
+                for (size_t i = 0; i < textures_.size(); ++i)
+                {
+                    if (i % columns_ != 0)
+                    {
+                        ImGui::SameLine(0.0f, 0.0f);
+                    }
+                    ImGui::Image(textures_[i]->GetImTextureID(), ImVec2(cell, cell));
+                }
+                ImGui::End();
+            }
+
+        private:
+            Application &app_;
+            int columns_;
+            int texture_size_;
+            std::vector<TextureHandle> textures_;
+        };
+
+        // A large TimeSeries streamed into a plot whose view follows a fixed script
+        // through every zoom level, so most frames redraw
+        class TimeSeriesPlotLayer : public Layer
+        {
+        public:
+            TimeSeriesPlotLayer(BenchmarkResult &result, size_t initial_samples,
+                                size_t samples_per_frame, bool force_cpu)
+                : Layer("TimeSeriesPlot"), result_(result), initial_samples_(initial_samples),
+                  block_(samples_per_frame)
+            {
+                plot_.SetForceCpu(force_cpu);
+            }
+
+            void OnAttach() override
+            {
+                // Generated in blocks, only the appends are timed
+                std::vector<float> block(1 << 20);
+                double append_ms = 0.0;
+                for (size_t appended = 0; appended < initial_samples_;)
+                {
+                    const size_t count = std::min(block.size(), initial_samples_ - appended);
+                    Generate(block.data(), count);
+                    append_ms += TimeAppend(block.data(), count);
+                    appended += count;
+                }
+                result_.metrics.push_back(
+                    {"bulk_append_ms", BenchmarkDistribution::Compute({append_ms})});
+                plot_.AddSeries(series_, IM_COL32(90, 170, 255, 255));
+            }
+
+            void OnDetach() override
+            {
+                result_.metrics.push_back(
+                    {"append_ms", BenchmarkDistribution::Compute(std::move(append_ms_))});
+                result_.metrics.push_back(
+                    {"plot_draw_ms", BenchmarkDistribution::Compute(std::move(draw_ms_))});
+                plot_.ClearSeries();
+            }
+
+            void OnRenderUI() override
+            {
+                // Appended on the GL thread, the plot reads the series while drawing
+                Generate(block_.data(), block_.size());
+                append_ms_.push_back(TimeAppend(block_.data(), block_.size()));
+
+                // 60 frames following the whole series, then 240 zooming in on one spot
+                const uint64_t phase = frame_ % 300;
+                const double total = static_cast<double>(series_.GetSize());
+                if (phase < 60)
+                {
+                    plot_.FitAll();
+                }
+                else
+                {
+                    const double length =
+                        total * std::pow(0.5, static_cast<double>(phase - 60) / 10.0);
+                    const double center = total * 0.37;
+                    plot_.SetView(center - length * 0.5, center + length * 0.5);
+                }
+                ++frame_;
+
+                FillMainViewport();
+                ImGui::Begin("Plot", nullptr, ImGuiWindowFlags_NoSavedSettings);
+                const auto start = std::chrono::steady_clock::now();
+                plot_.Draw("##series");
+                draw_ms_.push_back(std::chrono::duration<double, std::milli>(
+                                       std::chrono::steady_clock::now() - start)
+                                       .count());
+                ImGui::End();
+            }
+
+        private:
+            // Two tones plus deterministic noise, continuous across blocks
+            void Generate(float *values, size_t count)
+            {
+                for (size_t i = 0; i < count; ++i, ++generated_)
+                {
+                    noise_ = noise_ * 1664525u + 1013904223u;
+                    const double t = static_cast<double>(generated_);
+                    const double noise = static_cast<double>(noise_ >> 8) / 16777216.0 - 0.5;
+                    values[i] = static_cast<float>(std::sin(t * 1e-5) + 0.25 * std::sin(t * 3e-3) +
+                                                   0.05 * noise);
+                }
+            }
+
+            double TimeAppend(const float *values, size_t count)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                series_.Append(values, count);
+                const auto end = std::chrono::steady_clock::now();
+                return std::chrono::duration<double, std::milli>(end - start).count();
+            }
+
+            BenchmarkResult &result_;
+            size_t initial_samples_;
+            std::vector<float> block_;
+            TimeSeries series_;
+            TimeSeriesPlot plot_;
+            uint64_t generated_ = 0;
+            uint32_t noise_ = 1;
+            uint64_t frame_ = 0;
+            std::vector<double> append_ms_;
+            std::vector<double> draw_ms_;
+        };
+    } // namespace
+
+    std::vector<BenchmarkScenario> CreateBenchmarkScenarios()
+    {
+        std::vector<BenchmarkScenario> scenarios;
+
+        scenarios.push_back({"imgui_widgets", "5000 mixed ImGui widgets in one window", nullptr,
+                             [](Application &app, BenchmarkResult &)
+                             { app.PushLayer(std::make_unique<WidgetsLayer>(5000)); }});
+
+        scenarios.push_back({"imgui_widgets_cached",
+                             "imgui_widgets with reuse_unchanged_frames, the widgets never change",
+                             [](ApplicationSpecification &spec)
+                             { spec.reuse_unchanged_frames = true; },
+                             [](Application &app, BenchmarkResult &)
+                             { app.PushLayer(std::make_unique<WidgetsLayer>(5000)); }});
+
+        scenarios.push_back({"imgui_widgets_flux_renderer",
+                             "imgui_widgets drawn by the persistently mapped ImGui renderer",
+                             [](ApplicationSpecification &spec)
+                             { spec.imgui_renderer = ImGuiRendererBackend::Flux; },
+                             [](Application &app, BenchmarkResult &)
+                             { app.PushLayer(std::make_unique<WidgetsLayer>(5000)); }});
+
+        scenarios.push_back({"many_layers",
+                             "256 layers, each with update work, a window and mouse events",
+                             nullptr,
+                             [](Application &app, BenchmarkResult &)
+                             {
+                                 for (int i = 0; i < 256; ++i)
+                                 {
+                                     app.PushLayer(std::make_unique<SmallLayer>(i));
+                                 }
+                             }});
+
+        scenarios.push_back({"event_flood",
+                             "4096 scripted mouse events per frame into 32 listening layers",
+                             nullptr,
+                             [](Application &app, BenchmarkResult &)
+                             {
+                                 for (int i = 0; i < 32; ++i)
+                                 {
+                                     app.PushLayer(std::make_unique<SmallLayer>(i));
+                                 }
+                                 app.PushLayer(std::make_unique<InputFloodLayer>(app, 4096));
+                             }});
+
+        scenarios.push_back({"docking", "12 windows docked as tabs plus 4 floating windows",
+                             [](ApplicationSpecification &spec)
+                             { spec.imgui_docking_enabled = true; },
+                             [](Application &app, BenchmarkResult &)
+                             { app.PushLayer(std::make_unique<DockedWindowsLayer>(12, 4)); }});
+
+        scenarios.push_back({"texture_grid",
+                             "16x16 grid of distinct 256x256 images loaded asynchronously",
+                             [](ApplicationSpecification &spec)
+                             { spec.texture_disk_cache_directory.clear(); },
+                             [](Application &app, BenchmarkResult &)
+                             { app.PushLayer(std::make_unique<TextureGridLayer>(app, 16, 256)); }});
+
+        scenarios.push_back({"texture_grid_flux_renderer",
+                             "texture_grid drawn by the persistently mapped ImGui renderer",
+                             [](ApplicationSpecification &spec)
+                             {
+                                 spec.texture_disk_cache_directory.clear();
+                                 spec.imgui_renderer = ImGuiRendererBackend::Flux;
+                             },
+                             [](Application &app, BenchmarkResult &)
+                             { app.PushLayer(std::make_unique<TextureGridLayer>(app, 16, 256)); }});
+
+        scenarios.push_back({"plot_10m",
+                             "10M-sample time series plot, 10k samples appended per frame",
+                             nullptr,
+                             [](Application &app, BenchmarkResult &result)
+                             {
+                                 app.PushLayer(std::make_unique<TimeSeriesPlotLayer>(
+                                     result, 10000000, 10000, false));
+                             }});
+
+        scenarios.push_back({"plot_10m_cpu",
+                             "plot_10m decimated on the CPU and drawn through ImDrawList",
+                             nullptr,
+                             [](Application &app, BenchmarkResult &result)
+                             {
+                                 app.PushLayer(std::make_unique<TimeSeriesPlotLayer>(
+                                     result, 10000000, 10000, true));
+                             }});
+
+        scenarios.push_back({"plot_100m",
+                             "100M-sample time series plot, 100k samples appended per frame "
+                             "(about 1 GB of CPU and GPU memory)",
+                             nullptr,
+                             [](Application &app, BenchmarkResult &result)
+                             {
+                                 app.PushLayer(std::make_unique<TimeSeriesPlotLayer>(
+                                     result, 100000000, 100000, false));
+                             }});
+
+        return scenarios;
+    }
+
+} // namespace flux
@@ -9,7 +9,9 @@
 
 class MyLayer : public flux::Layer {
 public:
-    MyLayer() : Layer("MyLayer") {}
+    MyLayer() : Layer("MyLayer") {
+        SetEventCategoryMask(flux::EventCategoryKeyboard);
+    }
 
     void OnAttach() override {}
     void OnDetach() override {}
@@ -21,7 +23,7 @@ public:
     void OnRenderUI() override {
         ImGui::Begin("Hello, Flux!");
         ImGui::Text("This is a sample layer in MyApp.");
-        ImGui::Text("Frame time: %.3f ms", ImGui::GetIO().Framerate);
+        ImGui::Text("Frame time: %.3f ms", 1000.0f / ImGui::GetIO().Framerate);
         ImGui::End();
         ImGui::ShowDemoWindow();
     }
@@ -66,5 +68,6 @@ std::unique_ptr<flux::Application> flux::CreateApplication() {
     spec.vsync = true;
     spec.msaa_samples = 4;
     spec.resizable = true;
+    spec.profiler_overlay = true;
     return std::make_unique<MyApp>(spec);
 }